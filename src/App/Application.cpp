@@ -94,6 +94,7 @@
 #include <Base/PrecisionPy.h>
 #include <Base/ProgressIndicatorPy.h>
 #include <Base/RotationPy.h>
+#include <Base/Stream.h>
 #include <Base/UniqueNameManager.h>
 #include <Base/TimeInfo.h>
 #include <Base/SystemHandler.h>
@@ -110,6 +111,7 @@
 #include "ApplicationDirectories.h"
 #include "ApplicationDirectoriesPy.h"
 #include "ApplicationPy.h"
+#include "BatchRunner.h"
 #include "CleanupProcess.h"
 #include "ComplexGeoData.h"
 #include "ConsoleQtBridge.h"
@@ -2437,6 +2439,11 @@ void parseProgramOptions(int ac, char ** av, const std::string& exe, boost::prog
     ("python-path,P", boost::program_options::value< std::vector<std::string> >()->composing(),"Additional python paths")
     ("disable-addon", boost::program_options::value< std::vector<std::string> >()->composing(),"Disable a given addon.")
     ("single-instance", "Allow to run a single instance of the application")
+    ("batch", boost::program_options::value<std::string>(), "Open, recompute and export the documents listed in the given job file, then exit")
+    ("batch-jobs", boost::program_options::value<int>(), "Number of documents processed concurrently in batch mode (default: number of cores)")
+    ("batch-memory-limit", boost::program_options::value<long>(), "Memory limit in MB of each worker process in batch mode")
+    ("batch-worker", "Run the batch jobs read from the standard input, used by --batch")
+    ("batch-report", boost::program_options::value<std::string>(), "Write a JSON report of the batch jobs to the given file")
     ("safe-mode", "Force enable safe mode")
     ("pass", boost::program_options::value< std::vector<std::string> >()->multitoken(), "Ignores the following arguments and pass them through to be used by a script")
     ;
@@ -2676,6 +2683,25 @@ void processProgramOptions(const boost::program_options::variables_map& vm, std:
         mConfig["SingleInstance"] = "1";
     }
 
+    if (vm.contains("batch") || vm.contains("batch-worker")) {
+        mConfig["RunMode"] = "Batch";
+        if (vm.contains("batch")) {
+            mConfig["BatchFile"] = vm["batch"].as<std::string>();
+        }
+        if (vm.contains("batch-worker")) {
+            mConfig["BatchWorker"] = "1";
+        }
+        if (vm.contains("batch-jobs")) {
+            mConfig["BatchJobs"] = std::to_string(vm["batch-jobs"].as<int>());
+        }
+        if (vm.contains("batch-memory-limit")) {
+            mConfig["BatchMemoryLimit"] = std::to_string(vm["batch-memory-limit"].as<long>());
+        }
+        if (vm.contains("batch-report")) {
+            mConfig["BatchReport"] = vm["batch-report"].as<std::string>();
+        }
+    }
+
     if (vm.contains("dump-config")) {
         std::stringstream str;
         for (const auto & it : mConfig) {
@@ -3164,6 +3190,9 @@ void Application::runApplication()
         Base::Console().log("Running internal script:\n");
         Base::Interpreter().runString(Base::ScriptFactory().ProduceScript(mConfig["ScriptFileName"].c_str()));
     }
+    else if (mConfig["RunMode"] == "Batch") {
+        runBatch();
+    }
     else if (mConfig["RunMode"] == "Exit") {
         // getting out
         Base::Console().log("Exiting on purpose\n");
@@ -3173,6 +3202,46 @@ void Application::runApplication()
     }
 }
 
+void Application::runBatch()
+{
+    BatchRunner::Options options;
+    if (!mConfig["BatchJobs"].empty()) {
+        options.jobs = std::stoi(mConfig["BatchJobs"]);
+    }
+    if (!mConfig["BatchMemoryLimit"].empty()) {
+        options.memoryLimitMB = std::stol(mConfig["BatchMemoryLimit"]);
+    }
+    options.executable = _argv[0];
+
+    BatchRunner runner(options);
+    if (mConfig["BatchWorker"] == "1") {
+        runner.serve(std::cin, std::cout);
+        return;
+    }
+
+    std::vector<BatchJob> jobs = BatchRunner::readJobFile(mConfig["BatchFile"]);
+    std::vector<BatchJobResult> results = runner.run(jobs);
+
+    const std::string& report = mConfig["BatchReport"];
+    if (!report.empty()) {
+        Base::FileInfo fi(report);
+        Base::ofstream str(fi, std::ios::out | std::ios::trunc);
+        if (!str) {
+            throw Base::FileException("Cannot write batch report", fi);
+        }
+        runner.writeReport(str, jobs, results);
+    }
+
+    auto failed = std::count_if(results.begin(), results.end(), [](const BatchJobResult& result) {
+        return !result.success;
+    });
+    if (failed > 0) {
+        std::stringstream str;
+        str << failed << " of " << results.size() << " batch jobs failed";
+        throw Base::RuntimeError(str.str());
+    }
+}
+
 void Application::notifyRecomputeWorker()
 {
     _recomputeRequestAvailable.notify_one();
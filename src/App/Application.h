@@ -764,6 +764,9 @@ public:
     /// Run the application in a specific mode.
     static void runApplication();
 
+    /// Open, recompute and export the documents of the batch job file, see BatchRunner.
+    static void runBatch();
+
     friend Application &GetApplication();
 
     /// Get the application configuration map.
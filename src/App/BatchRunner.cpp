@@ -0,0 +1,619 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <FCConfig.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <thread>
+
+#ifndef FC_OS_WIN32
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QStringList>
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
+#include <Base/Stream.h>
+#include <Base/TimeInfo.h>
+#include <Base/Tools.h>
+
+#include "Application.h"
+#include "BatchRunner.h"
+#include "Document.h"
+#include "DocumentObject.h"
+
+
+using namespace App;
+
+namespace
+{
+
+// Starts the result line of a worker, the rest of its output is ignored
+constexpr const char* ResultMarker = "BatchResult: ";
+
+// Time in ms a worker gets to exit after its input is closed
+constexpr int ShutdownTimeout = 30000;
+
+std::string trimmed(const std::string& str)
+{
+    auto begin = str.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return {};
+    }
+    auto end = str.find_last_not_of(" \t\r\n");
+    return str.substr(begin, end - begin + 1);
+}
+
+/// Split a job file line at ';', a field in double quotes may contain ';'
+std::vector<std::string> splitFields(const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    bool quoted = false;
+    bool wasQuoted = false;
+    auto addField = [&]() {
+        std::string value = wasQuoted ? field : trimmed(field);
+        if (!value.empty()) {
+            fields.push_back(std::move(value));
+        }
+        field.clear();
+        wasQuoted = false;
+    };
+
+    for (std::size_t i = 0; i < line.size(); ++i) {
+        char c = line[i];
+        if (quoted) {
+            if (c != '"') {
+                field += c;
+            }
+            else if (i + 1 < line.size() && line[i + 1] == '"') {
+                field += c;
+                ++i;
+            }
+            else {
+                quoted = false;
+            }
+        }
+        else if (c == '"' && trimmed(field).empty()) {
+            field.clear();
+            quoted = true;
+            wasQuoted = true;
+        }
+        else if (c == ';') {
+            addField();
+        }
+        else if (!wasQuoted) {
+            field += c;
+        }
+    }
+    if (quoted) {
+        throw Base::ParserError("Missing closing quote in batch job: " + line);
+    }
+    addField();
+    return fields;
+}
+
+QJsonArray toJsonArray(const std::vector<std::string>& values)
+{
+    QJsonArray array;
+    for (const auto& value : values) {
+        array.append(QString::fromStdString(value));
+    }
+    return array;
+}
+
+QJsonObject toJsonObject(const BatchJobResult& result)
+{
+    QJsonObject obj;
+    obj[QLatin1String("success")] = result.success;
+    obj[QLatin1String("error")] = QString::fromStdString(result.error);
+    obj[QLatin1String("seconds")] = result.seconds;
+    obj[QLatin1String("maxResidentKB")] = static_cast<qint64>(result.maxResidentKB);
+    return obj;
+}
+
+/// Peak resident memory of this process in KiB, 0 if unknown
+long peakResidentKB()
+{
+#ifdef FC_OS_WIN32
+    return 0;
+#else
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef FC_OS_MACOSX
+    return static_cast<long>(usage.ru_maxrss / 1024);
+#else
+    return static_cast<long>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+/// Run a job in this process and catch its errors
+void runGuarded(const BatchJob& job, BatchJobResult& result)
+{
+    Base::TimeElapsed start;
+    try {
+        BatchRunner::runJob(job);
+        result.success = true;
+    }
+    catch (const Base::SystemExitException&) {
+        throw;
+    }
+    catch (const Base::Exception& e) {
+        result.error = e.what();
+    }
+    catch (const std::exception& e) {
+        result.error = e.what();
+    }
+    catch (...) {
+        result.error = "Unknown exception";
+    }
+    result.seconds = Base::TimeElapsed::diffTimeF(start);
+    result.maxResidentKB = peakResidentKB();
+}
+
+/** A worker process that runs one job after the other
+ *
+ * It must be used by a single thread only. The jobs are written to the standard
+ * input of the worker, and the reply is read with a blocking wait. A worker that
+ * is still running when this is destroyed gets its input closed and is waited
+ * for, and killed if it does not exit.
+ */
+class WorkerProcess
+{
+public:
+    explicit WorkerProcess(const BatchRunner::Options& options)
+        : options(options)
+    {}
+
+    ~WorkerProcess()
+    {
+        stop();
+    }
+
+    WorkerProcess(const WorkerProcess&) = delete;
+    WorkerProcess& operator=(const WorkerProcess&) = delete;
+
+    bool isRunning() const
+    {
+        return process && process->state() != QProcess::NotRunning;
+    }
+
+    bool start(std::string& error)
+    {
+        QStringList args {QStringLiteral("--batch-worker")};
+        if (options.memoryLimitMB > 0) {
+            args << QStringLiteral("--batch-memory-limit") << QString::number(options.memoryLimitMB);
+        }
+
+        process = std::make_unique<QProcess>();
+        // The results are read from the standard output, only pass on the error output
+        process->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+        process->start(QString::fromStdString(options.executable), args);
+        if (!process->waitForStarted()) {
+            error = "Cannot start " + options.executable + ": "
+                + process->errorString().toStdString();
+            process.reset();
+            return false;
+        }
+        return true;
+    }
+
+    void runJob(const BatchJob& job, BatchJobResult& result)
+    {
+        Base::TimeElapsed start;
+        QByteArray line = QByteArray::fromStdString(BatchRunner::encodeJob(job));
+        line += '\n';
+        process->write(line);
+
+        bool received = false;
+        while (!received) {
+            if (!process->canReadLine() && !process->waitForReadyRead(-1)
+                && !process->canReadLine()) {
+                break;
+            }
+            while (!received && process->canReadLine()) {
+                received = BatchRunner::decodeResult(
+                    process->readLine().trimmed().toStdString(),
+                    result
+                );
+            }
+        }
+
+        // The duration includes the time to pass the job on
+        result.seconds = Base::TimeElapsed::diffTimeF(start);
+        if (!received) {
+            process->waitForFinished();
+            result.success = false;
+            if (process->exitStatus() == QProcess::CrashExit) {
+                result.error = "Worker crashed";
+            }
+            else {
+                result.error = "Worker exited with code " + std::to_string(process->exitCode());
+            }
+            process.reset();
+        }
+    }
+
+    void stop()
+    {
+        if (!isRunning()) {
+            return;
+        }
+        process->closeWriteChannel();
+        if (!process->waitForFinished(ShutdownTimeout)) {
+            process->kill();
+            process->waitForFinished();
+        }
+        process.reset();
+    }
+
+private:
+    const BatchRunner::Options& options;
+    std::unique_ptr<QProcess> process;
+};
+
+}  // namespace
+
+BatchRunner::BatchRunner(const Options& options)
+    : options(options)
+{
+    if (this->options.jobs <= 0) {
+        this->options.jobs = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+}
+
+std::vector<BatchJob> BatchRunner::readJobs(std::istream& str)
+{
+    std::vector<BatchJob> jobs;
+    std::string line;
+    while (std::getline(str, line)) {
+        line = trimmed(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::vector<std::string> fields = splitFields(line);
+        if (fields.empty()) {
+            continue;
+        }
+        BatchJob job;
+        job.input = fields.front();
+        job.outputs.assign(fields.begin() + 1, fields.end());
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+std::vector<BatchJob> BatchRunner::readJobFile(const std::string& fileName)
+{
+    Base::FileInfo fi(fileName);
+    Base::ifstream str(fi, std::ios::in);
+    if (!str) {
+        throw Base::FileException("Cannot open batch job file", fi);
+    }
+    return readJobs(str);
+}
+
+void BatchRunner::runJob(const BatchJob& job)
+{
+    Document* doc = GetApplication().openDocument(job.input.c_str());
+    if (!doc) {
+        throw Base::FileException("Cannot open document", job.input);
+    }
+    std::string docName = doc->getName();
+
+    try {
+        doc->recompute();
+        for (auto obj : doc->getObjects()) {
+            if (obj->isError()) {
+                std::stringstream str;
+                str << "Recompute failed: " << obj->getFullName() << ": "
+                    << obj->getStatusString();
+                throw Base::RuntimeError(str.str());
+            }
+        }
+
+        for (const auto& output : job.outputs) {
+            Base::FileInfo fi(output);
+            std::vector<std::string> mods = GetApplication().getExportModules(fi.extension());
+            if (mods.empty()) {
+                throw Base::FileException("File format not supported", fi);
+            }
+            std::string fileName = Base::Tools::escapeEncodeFilename(output);
+            Base::Interpreter().runStringArg("import %s", mods.front().c_str());
+            Base::Interpreter().runStringArg(
+                "%s.export(App.getDocument('%s').Objects, '%s')",
+                mods.front().c_str(),
+                docName.c_str(),
+                fileName.c_str()
+            );
+        }
+    }
+    catch (...) {
+        GetApplication().closeDocument(docName.c_str());
+        throw;
+    }
+    GetApplication().closeDocument(docName.c_str());
+}
+
+std::vector<BatchJobResult> BatchRunner::run(const std::vector<BatchJob>& jobs)
+{
+    finished = 0;
+    total = jobs.size();
+    Base::TimeElapsed start;
+
+    std::vector<BatchJobResult> results;
+    if (options.executable.empty()) {
+        results = runSerial(jobs);
+    }
+    else {
+        results = runProcesses(jobs);
+    }
+
+    seconds = Base::TimeElapsed::diffTimeF(start);
+    return results;
+}
+
+std::vector<BatchJobResult> BatchRunner::runSerial(const std::vector<BatchJob>& jobs)
+{
+    std::vector<BatchJobResult> results(jobs.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        runGuarded(jobs[i], results[i]);
+        reportProgress(jobs[i], results[i]);
+    }
+    return results;
+}
+
+std::vector<BatchJobResult> BatchRunner::runProcesses(const std::vector<BatchJob>& jobs)
+{
+    std::vector<BatchJobResult> results(jobs.size());
+    std::mutex mutex;
+    std::condition_variable jobDone;
+    std::size_t next = 0;
+    std::deque<std::size_t> done;
+
+    // Every thread owns one worker process and feeds it the next job until none is left
+    auto serveWorker = [&]() {
+        WorkerProcess worker(options);
+        while (true) {
+            std::size_t index {};
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (next >= jobs.size()) {
+                    break;
+                }
+                index = next++;
+            }
+
+            BatchJobResult result;
+            try {
+                std::string error;
+                if (!worker.isRunning() && !worker.start(error)) {
+                    result.error = error;
+                }
+                else {
+                    worker.runJob(jobs[index], result);
+                }
+            }
+            catch (const std::exception& e) {
+                result.success = false;
+                result.error = e.what();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                results[index] = std::move(result);
+                done.push_back(index);
+            }
+            jobDone.notify_one();
+        }
+    };
+
+    std::size_t count = std::min(static_cast<std::size_t>(options.jobs), jobs.size());
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        threads.emplace_back(serveWorker);
+    }
+
+    try {
+        for (std::size_t reported = 0; reported < jobs.size(); ++reported) {
+            std::size_t index {};
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobDone.wait(lock, [&]() { return !done.empty(); });
+                index = done.front();
+                done.pop_front();
+            }
+            reportProgress(jobs[index], results[index]);
+        }
+    }
+    catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            next = jobs.size();
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
+
+void BatchRunner::serve(std::istream& in, std::ostream& out) const
+{
+#ifndef FC_OS_WIN32
+    if (options.memoryLimitMB > 0) {
+        rlim_t limit = static_cast<rlim_t>(options.memoryLimitMB) * 1024 * 1024;
+        struct rlimit rl
+        {
+            limit, limit
+        };
+        setrlimit(RLIMIT_AS, &rl);
+    }
+#endif
+
+    std::string line;
+    while (std::getline(in, line)) {
+        line = trimmed(line);
+        if (line.empty()) {
+            continue;
+        }
+        BatchJobResult result;
+        try {
+            BatchJob job = decodeJob(line);
+            runGuarded(job, result);
+        }
+        catch (const Base::ParserError& e) {
+            result.error = e.what();
+        }
+        out << encodeResult(result) << std::endl;
+    }
+}
+
+std::string BatchRunner::encodeJob(const BatchJob& job)
+{
+    QJsonObject obj;
+    obj[QLatin1String("input")] = QString::fromStdString(job.input);
+    obj[QLatin1String("outputs")] = toJsonArray(job.outputs);
+    return QJsonDocument(obj).toJson(QJsonDocument::Compact).toStdString();
+}
+
+BatchJob BatchRunner::decodeJob(const std::string& line)
+{
+    QJsonParseError error {};
+    QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &error);
+    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+        throw Base::ParserError("Invalid batch job: " + line);
+    }
+
+    QJsonObject obj = doc.object();
+    BatchJob job;
+    job.input = obj.value(QLatin1String("input")).toString().toStdString();
+    for (const auto& output : obj.value(QLatin1String("outputs")).toArray()) {
+        job.outputs.push_back(output.toString().toStdString());
+    }
+    return job;
+}
+
+std::string BatchRunner::encodeResult(const BatchJobResult& result)
+{
+    return ResultMarker
+        + QJsonDocument(toJsonObject(result)).toJson(QJsonDocument::Compact).toStdString();
+}
+
+bool BatchRunner::decodeResult(const std::string& line, BatchJobResult& result)
+{
+    // Output of the job without a line break may come first
+    std::string marker(ResultMarker);
+    auto pos = line.find(marker);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    QJsonDocument doc =
+        QJsonDocument::fromJson(QByteArray::fromStdString(line.substr(pos + marker.size())));
+    if (!doc.isObject()) {
+        return false;
+    }
+
+    QJsonObject obj = doc.object();
+    result.success = obj.value(QLatin1String("success")).toBool();
+    result.error = obj.value(QLatin1String("error")).toString().toStdString();
+    result.seconds = obj.value(QLatin1String("seconds")).toDouble();
+    result.maxResidentKB = static_cast<long>(obj.value(QLatin1String("maxResidentKB")).toDouble());
+    return true;
+}
+
+void BatchRunner::reportProgress(const BatchJob& job, const BatchJobResult& result)
+{
+    ++finished;
+    if (result.success) {
+        Base::Console().message(
+            "Batch: [%zu/%zu] %s (%.2f s)\n",
+            finished,
+            total,
+            job.input.c_str(),
+            result.seconds
+        );
+    }
+    else {
+        Base::Console().error(
+            "Batch: [%zu/%zu] %s failed: %s\n",
+            finished,
+            total,
+            job.input.c_str(),
+            result.error.c_str()
+        );
+    }
+}
+
+void BatchRunner::writeReport(
+    std::ostream& str,
+    const std::vector<BatchJob>& jobs,
+    const std::vector<BatchJobResult>& results
+) const
+{
+    auto failed = std::count_if(results.begin(), results.end(), [](const BatchJobResult& result) {
+        return !result.success;
+    });
+
+    QJsonArray entries;
+    for (std::size_t i = 0; i < results.size() && i < jobs.size(); ++i) {
+        QJsonObject entry = toJsonObject(results[i]);
+        entry[QLatin1String("input")] = QString::fromStdString(jobs[i].input);
+        entry[QLatin1String("outputs")] = toJsonArray(jobs[i].outputs);
+        entries.append(entry);
+    }
+
+    QJsonObject report;
+    report[QLatin1String("jobs")] = static_cast<qint64>(results.size());
+    report[QLatin1String("workers")] = options.jobs;
+    report[QLatin1String("memoryLimitMB")] = static_cast<qint64>(options.memoryLimitMB);
+    report[QLatin1String("succeeded")] = static_cast<qint64>(results.size() - failed);
+    report[QLatin1String("failed")] = static_cast<qint64>(failed);
+    report[QLatin1String("seconds")] = seconds;
+    report[QLatin1String("results")] = entries;
+
+    QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    str.write(json.constData(), json.size());
+}
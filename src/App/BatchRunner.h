@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+/// A document to open, recompute and export
+struct AppExport BatchJob
+{
+    std::string input;
+    std::vector<std::string> outputs;
+};
+
+struct AppExport BatchJobResult
+{
+    bool success {false};
+    std::string error;
+    double seconds {0.0};
+    /// Peak resident memory in KiB of the process that ran the job, 0 if unknown
+    long maxResidentKB {0};
+};
+
+/** Headless batch mode, started with the command line option --batch
+ *
+ * The jobs are run by a number of worker processes, which are this application
+ * started again with --batch-worker. A worker stays alive for several jobs: it
+ * reads one job per line from its standard input and writes the result to its
+ * standard output. A worker that crashes only fails its current job and is
+ * started again for the next one. The memory limit applies to each worker.
+ * Without an executable the jobs are run one after the other in this process.
+ */
+class AppExport BatchRunner
+{
+public:
+    struct Options
+    {
+        /// Number of worker processes, 0 to use the number of cores
+        int jobs {0};
+        /// Address space limit of each worker in MiB, 0 for no limit
+        long memoryLimitMB {0};
+        /// The program that runs the jobs, usually this application
+        std::string executable;
+    };
+
+    explicit BatchRunner(const Options& options);
+
+    /** Read a job file
+     *
+     * Every line lists a document followed by its export files, separated by ';'.
+     * A file name that contains ';' or '"' is put in double quotes, with '"'
+     * doubled. The exporter is chosen by the file extension. Empty lines and
+     * lines starting with '#' are ignored.
+     */
+    static std::vector<BatchJob> readJobs(std::istream& str);
+    static std::vector<BatchJob> readJobFile(const std::string& fileName);
+
+    /// Run all jobs, the results are in the same order
+    std::vector<BatchJobResult> run(const std::vector<BatchJob>& jobs);
+    /// Run one job in this process, throws on failure
+    static void runJob(const BatchJob& job);
+
+    /** Run the jobs of a worker process
+     *
+     * Applies the memory limit to this process, then reads one encoded job per
+     * line from \a in until the end of the input. The result of every job is
+     * written to \a out as a line of its own.
+     */
+    void serve(std::istream& in, std::ostream& out) const;
+
+    /// The single line encodings of the worker protocol, decodeJob() throws on invalid input
+    static std::string encodeJob(const BatchJob& job);
+    static BatchJob decodeJob(const std::string& line);
+    static std::string encodeResult(const BatchJobResult& result);
+    /// Returns false if \a line is not a result line, other output of a worker is skipped
+    static bool decodeResult(const std::string& line, BatchJobResult& result);
+
+    /// Write a JSON report of the finished jobs
+    void writeReport(
+        std::ostream& str,
+        const std::vector<BatchJob>& jobs,
+        const std::vector<BatchJobResult>& results
+    ) const;
+
+private:
+    std::vector<BatchJobResult> runSerial(const std::vector<BatchJob>& jobs);
+    std::vector<BatchJobResult> runProcesses(const std::vector<BatchJob>& jobs);
+    void reportProgress(const BatchJob& job, const BatchJobResult& result);
+
+private:
+    Options options;
+    std::size_t finished {0};
+    std::size_t total {0};
+    double seconds {0.0};
+};
+
+}  // namespace App
@@ -2855,6 +2855,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
 
     // delete recompute log
     d->clearRecomputeLog();
+    d->clearRecomputeProfile();
 
     Base::TimeTracker tracker("Document::recompute");
     std::optional<Base::ObjectStatusLocker<Document::Status, Document>> recomputingStatus;
@@ -2916,7 +2917,9 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                 if (obj->mustRecompute()) {
                     doRecompute = true;
                     ++objectCount;
+                    d->beginRecomputeProfile(obj->getNameInDocument());
                     int res = _recomputeFeature(obj);
+                    d->endRecomputeProfile();
                     if (res != 0) {
                         if (hasError) {
                             *hasError = true;
@@ -3205,6 +3208,30 @@ const char* Document::getErrorDescription(const DocumentObject* Obj) const
     return d->findRecomputeLog(Obj);
 }
 
+const std::vector<Document::RecomputeProfileEntry>& Document::getRecomputeProfile() const
+{
+    return d->recomputeProfile;
+}
+
+void Document::exportRecomputeProfile(std::ostream& out) const
+{
+    // Complete events ("ph": "X") with time stamps in microseconds, see the
+    // Trace Event Format of the Chrome tracing tools
+    constexpr double microseconds = 1e6;
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    const char* separator = "\n";
+    for (const auto& entry : d->recomputeProfile) {
+        out << separator << "{\"name\": \"" << entry.name
+            << "\", \"cat\": \"recompute\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1"
+            << ", \"ts\": " << entry.start * microseconds
+            << ", \"dur\": " << entry.total * microseconds
+            << ", \"args\": {\"self\": " << entry.self * microseconds
+            << ", \"depth\": " << entry.depth << "}}";
+        separator = ",\n";
+    }
+    out << "\n]}\n";
+}
+
 // call the recompute of the Feature and handle the exceptions and errors.
 int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
 {
@@ -3278,7 +3305,13 @@ bool Document::recomputeFeature(DocumentObject* feature, bool recursive)
         recompute({feature}, true, &hasError);
         return !hasError;
     }
+    // A feature recomputed from within a recompute adds to its profile
+    if (!testStatus(Document::Recomputing) && d->recomputeProfileStack.empty()) {
+        d->clearRecomputeProfile();
+    }
+    d->beginRecomputeProfile(feature->getNameInDocument());
     _recomputeFeature(feature);
+    d->endRecomputeProfile();
     signalRecomputedObject(*feature);
     return feature->isValid();
 }
@@ -3328,34 +3361,164 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         throw Base::TypeError(str.str());
     }
 
-    std::vector<DocumentObject*> objects;
-    objects.resize(objectNames.size());
-    std::generate(objects.begin(), objects.end(), [&] {
-        return static_cast<DocumentObject*>(type.createInstance());
-    });
-    // the type instance could be a null pointer, it is enough to check the first element
-    if (!objects.empty() && !objects[0]) {
-        objects.clear();
-        return objects;
+    // the type instance could be a null pointer
+    if (!type.canInstantiate()) {
+        return {};
+    }
+
+    return addObjects(std::vector<std::string>(objectNames.size(), sType), objectNames, isNew);
+}
+
+std::vector<DocumentObject*> Document::addObjects(const std::vector<std::string>& types,
+                                                  const std::vector<std::string>& objectNames,
+                                                  bool isNew)
+{
+    if (!objectNames.empty() && objectNames.size() != types.size()) {
+        throw Base::ValueError(
+            "Document::addObjects: the number of names does not match the number of types");
+    }
+
+    // check all types before anything is added to the document
+    std::unordered_map<std::string, Base::Type> typeMap;
+    std::vector<Base::Type> objectTypes;
+    objectTypes.reserve(types.size());
+    for (const auto& typeName : types) {
+        auto it = typeMap.find(typeName);
+        if (it == typeMap.end()) {
+            Base::Type type = Base::Type::getTypeIfDerivedFrom(typeName.c_str(),
+                                                               DocumentObject::getClassTypeId(),
+                                                               true);
+            if (type.isBad() || !type.canInstantiate()) {
+                std::stringstream str;
+                str << "Document::addObjects: '" << typeName
+                    << "' is not a creatable document object type";
+                throw Base::TypeError(str.str());
+            }
+            it = typeMap.emplace(typeName, type).first;
+        }
+        objectTypes.push_back(it->second);
     }
 
-    for (auto it = objects.begin(); it != objects.end(); ++it) {
-        size_t index = std::distance(objects.begin(), it);
-        DocumentObject* pcObject = *it;
-        pcObject->setDocument(this);
+    // Reserve the names up front, before the first object is created, so that a
+    // failure halfway can release the names that were not used. Each name is still
+    // made unique on its own against the names reserved before it.
+    std::vector<std::string> reservedNames;
+    reservedNames.reserve(types.size());
+    for (std::size_t index = 0; index < objectTypes.size(); ++index) {
+        const char* proposedName = objectNames.empty() ? nullptr : objectNames[index].c_str();
+        if (Base::Tools::isNullOrEmpty(proposedName)) {
+            proposedName = objectTypes[index].getName();
+        }
+        reservedNames.push_back(getUniqueObjectName(proposedName));
+        d->objectNameManager.addExactName(reservedNames.back());
+    }
+
+    std::vector<DocumentObject*> objects;
+    objects.reserve(objectTypes.size());
+
+    BulkObjectCreation bulk(this);
+    std::size_t index = 0;
+    try {
+        for (; index < objectTypes.size(); ++index) {
+            auto* pcObject = static_cast<DocumentObject*>(objectTypes[index].createInstance());
+            pcObject->setDocument(this);
 
-        // Add the object but only activate the last one
-        bool isLast = index == (objects.size() - 1);
-        _addObject(pcObject,
-                   objectNames[index].c_str(),
-                   AddObjectOption::SetNewStatus
-                       | (isNew ? AddObjectOption::DoSetup : AddObjectOption::None)
-                       | (isLast ? AddObjectOption::ActivateObject : AddObjectOption::None));
+            // Add the object but only activate the last one
+            bool isLast = index == (objectTypes.size() - 1);
+            _addObject(pcObject,
+                       reservedNames[index].c_str(),
+                       AddObjectOption::SetNewStatus | AddObjectOption::ReservedName
+                           | (isNew ? AddObjectOption::DoSetup : AddObjectOption::None)
+                           | (isLast ? AddObjectOption::ActivateObject : AddObjectOption::None));
+            objects.push_back(pcObject);
+        }
+    }
+    catch (...) {
+        // release the names that have not been taken by an object
+        if (index < reservedNames.size() && d->objectMap.count(reservedNames[index]) != 0) {
+            ++index;
+        }
+        for (; index < reservedNames.size(); ++index) {
+            d->objectNameManager.removeExactName(reservedNames[index]);
+        }
+        throw;
     }
 
     return objects;
 }
 
+bool Document::isBulkCreation() const
+{
+    return d->bulkCreation > 0;
+}
+
+void Document::_beginBulkCreation()
+{
+    ++d->bulkCreation;
+}
+
+void Document::_endBulkCreation()
+{
+    if (d->bulkCreation <= 0 || --d->bulkCreation > 0) {
+        return;
+    }
+
+    auto pending = std::move(d->bulkNewObjects);
+    d->bulkNewObjects.clear();
+    long activeId = d->bulkActiveObject;
+    d->bulkActiveObject = 0;
+
+    // objects may have been removed again in the meantime
+    std::vector<DocumentObject*> objects;
+    objects.reserve(pending.size());
+    for (long id : pending) {
+        auto it = d->objectIdMap.find(id);
+        if (it != d->objectIdMap.end() && it->second->isAttachedToDocument()) {
+            objects.push_back(it->second);
+        }
+    }
+    if (objects.empty()) {
+        return;
+    }
+
+    signalNewObjects(objects);
+
+    for (auto pcObject : objects) {
+        signalNewObject(*pcObject);
+    }
+
+    if (activeId != 0 && d->activeObject && d->activeObject->getID() == activeId) {
+        signalActivatedObject(*d->activeObject);
+    }
+}
+
+BulkObjectCreation::BulkObjectCreation(Document* doc)
+    : doc(doc)
+{
+    doc->_beginBulkCreation();
+}
+
+BulkObjectCreation::~BulkObjectCreation()
+{
+    try {
+        doc->_endBulkCreation();
+        return;
+    }
+    catch (Base::Exception& e) {
+        e.reportException();
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;
+        e.reportException();
+    }
+    catch (std::exception& e) {
+        FC_ERR(e.what());
+    }
+    catch (...) {
+    }
+    FC_ERR("Exception when ending bulk creation of " << doc->getName());
+}
+
 void Document::addObject(DocumentObject* obj, const char* name)
 {
     if (obj->getDocument()) {
@@ -3371,7 +3534,11 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
 {
     // get unique name
     string ObjectName;
-    if (!Base::Tools::isNullOrEmpty(pObjectName)) {
+    if (options.testFlag(AddObjectOption::ReservedName)) {
+        // already made unique and registered by the caller
+        ObjectName = pObjectName;
+    }
+    else if (!Base::Tools::isNullOrEmpty(pObjectName)) {
         ObjectName = getUniqueObjectName(pObjectName);
     }
     else {
@@ -3380,7 +3547,9 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
 
     // insert in the name map
     d->objectMap[ObjectName] = pcObject;
-    d->objectNameManager.addExactName(ObjectName);
+    if (!options.testFlag(AddObjectOption::ReservedName)) {
+        d->objectNameManager.addExactName(ObjectName);
+    }
     // cache the pointer to the name string in the Object (for performance of
     // DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
@@ -3425,6 +3594,21 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     pcObject->_pcViewProviderName = viewType ? viewType : "";
 
+    if (d->bulkCreation > 0) {
+        // The transaction is told right away, so that removing the object again
+        // inside the bulk creation is undone correctly. Only the notifications
+        // are sent when the bulk creation ends.
+        if (!d->rollback && d->activeUndoTransaction) {
+            signalTransactionAppend(*pcObject, d->activeUndoTransaction);
+        }
+        d->bulkNewObjects.push_back(pcObject->_Id);
+        if (options.testFlag(AddObjectOption::ActivateObject)) {
+            d->activeObject = pcObject;
+            d->bulkActiveObject = pcObject->_Id;
+        }
+        return;
+    }
+
     signalNewObject(*pcObject);
 
     // do no transactions if we do a rollback!
@@ -3518,6 +3702,7 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
 
     // Mark the object as about to be removed
     pcObject->setStatus(ObjectStatus::Remove, true);
+    pcObject->invalidateSubObjectCache();
     if (!d->undoing && !d->rollback) {
         pcObject->unsetupObject();
     }
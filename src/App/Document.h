@@ -58,7 +58,8 @@ enum class AddObjectOption
     SetPartialStatus = 2,
     UnsetPartialStatus = 4,
     DoSetup = 8,
-    ActivateObject = 16
+    ActivateObject = 16,
+    ReservedName = 32
 };
 using AddObjectOptions = Base::Flags<AddObjectOption>;
 
@@ -144,6 +145,21 @@ public:
     };
     // clang-format on
 
+    /// Time spent in an object during a recompute, see getRecomputeProfile().
+    struct RecomputeProfileEntry
+    {
+        /// The name of the object.
+        std::string name;
+        /// Seconds from the start of the recompute to the start of the object.
+        double start {0.0};
+        /// Seconds spent in the object, including nested recomputes of other objects.
+        double total {0.0};
+        /// Seconds spent in the object itself, without nested recomputes.
+        double self {0.0};
+        /// Nesting level, 0 for the objects that are not recomputed by another one.
+        int depth {0};
+    };
+
     // NOLINTBEGIN
     /** @name Properties
      * @{
@@ -207,6 +223,14 @@ public:
     App::MainThreadSignal<void(const Document&, const Property&)> signalChanged;
     /// Signal on new object.
     App::MainThreadSignal<void(const DocumentObject&)> signalNewObject;
+    /**
+     * @brief Signal on objects created during a bulk creation.
+     *
+     * The signal is emitted once with all objects when the outermost
+     * BulkObjectCreation ends, right before signalNewObject is emitted for
+     * each of them.
+     */
+    App::MainThreadSignal<void(const std::vector<DocumentObject*>&)> signalNewObjects;
     /// Signal on a deleted object.
     App::MainThreadSignal<void(const DocumentObject&)> signalDeletedObject;
     /// Signal before changing an object.
@@ -511,6 +535,40 @@ public:
     std::vector<DocumentObject*>
     addObjects(const char* sType, const std::vector<std::string>& objectNames, bool isNew = true);
 
+    /**
+     * @brief Add multiple objects of different types to the document.
+     *
+     * All types are checked and all names are reserved before the first
+     * object is created, and the objects are added inside a bulk creation so
+     * that observers are notified once for the whole batch.  Only the last
+     * object is activated.
+     *
+     * @param[in] types       The types of the created objects.
+     * @param[in] objectNames The object names, either empty or one per type.
+     * An empty name generates a unique name based on the type.
+     * @param[in] isNew If false don't call the DocumentObject::setupObject()
+     * callback (default is true)
+     *
+     * @return The newly added objects in the order of @p types.
+     *
+     * @throws Base::TypeError If a type is not a creatable document object type.
+     * @throws Base::ValueError If the number of names does not match the types.
+     */
+    std::vector<DocumentObject*> addObjects(const std::vector<std::string>& types,
+                                            const std::vector<std::string>& objectNames,
+                                            bool isNew = true);
+
+    /**
+     * @brief Check if objects are being created in bulk.
+     *
+     * While a BulkObjectCreation is active, signalNewObject and
+     * signalActivatedObject of added objects are held back until the outermost
+     * bulk creation ends.  signalTransactionAppend is still emitted when the
+     * object is added, so that undo covers objects that are removed again
+     * before the bulk creation ends.
+     */
+    bool isBulkCreation() const;
+
     /**
      * @brief Remove an object from the document.
      *
@@ -812,6 +870,27 @@ public:
      */
     const char* getErrorDescription(const DocumentObject* Obj) const;
 
+    /**
+     * @brief Get the time spent in each object during the last recompute.
+     *
+     * An object that recomputes other objects while it is recomputed, e.g. with
+     * recomputeFeature(), includes their time in its total but not in its self
+     * time.
+     *
+     * @return The entries in the order the objects started their recompute.
+     */
+    const std::vector<RecomputeProfileEntry>& getRecomputeProfile() const;
+
+    /**
+     * @brief Write the last recompute profile as Chrome trace events.
+     *
+     * The output is a JSON document that can be loaded in chrome://tracing or
+     * the Perfetto UI, with one complete event per recomputed object.
+     *
+     * @param[in,out] out The stream to write to.
+     */
+    void exportRecomputeProfile(std::ostream& out) const;
+
     /**
      * @brief Get the status of this document for a given status bit.
      *
@@ -1284,6 +1363,7 @@ public:
     friend class DocumentObject;
     friend class Transaction;
     friend class TransactionDocumentObject;
+    friend class BulkObjectCreation;
 
     ~Document() override;
 
@@ -1317,6 +1397,11 @@ protected:
      */
     void _addObject(DocumentObject* pcObject, const char* pObjectName, AddObjectOptions options = AddObjectOption::ActivateObject, const char* viewType = nullptr);
 
+    /// Start a bulk creation, see BulkObjectCreation.
+    void _beginBulkCreation();
+    /// End a bulk creation and emit the held back signals if it was the outermost one.
+    void _endBulkCreation();
+
     /**
      * @brief Check if a valid transaction is open.
      *
@@ -1470,6 +1555,51 @@ private:
     bool autoCreated;    // Flag to know if the document was automatically created at startup
 };
 
+/**
+ * @brief Helper class to create many objects in a document at once.
+ *
+ * While the helper is alive the document holds back the per object
+ * notifications of added objects.  When the outermost helper of the document
+ * is destroyed, signalNewObjects is emitted once for all objects still in the
+ * document, followed by the usual signalNewObject of each one, so that
+ * observers like the GUI can create the view providers in one pass.  Helpers
+ * can be nested.
+ *
+ * Observers see the signals of an object added in bulk in this order:
+ * - signalTransactionAppend, right when the object is added and a
+ *   transaction is open;
+ * - signalBeforeChangeObject and signalChangedObject of property changes
+ *   made while the helper is alive, before the object was announced.  The
+ *   object has no view provider yet, so ViewObject is None in Python;
+ * - signalNewObjects and signalNewObject when the outermost helper ends.
+ *   Objects removed in the meantime only get signalDeletedObject;
+ * - signalActivatedObject, if the object is the active one.
+ *
+ * @code
+ * App::BulkObjectCreation bulk(doc);
+ * for (const auto& name : names) {
+ *     doc->addObject("App::FeaturePython", name.c_str());
+ * }
+ * @endcode
+ */
+class AppExport BulkObjectCreation
+{
+public:
+    explicit BulkObjectCreation(Document* doc);
+    ~BulkObjectCreation();
+
+    BulkObjectCreation(const BulkObjectCreation&) = delete;
+    BulkObjectCreation& operator=(const BulkObjectCreation&) = delete;
+    BulkObjectCreation(BulkObjectCreation&&) = delete;
+    BulkObjectCreation& operator=(BulkObjectCreation&&) = delete;
+
+    /// Delete the new operator to prevent heap allocation.
+    void* operator new(std::size_t) = delete;
+
+private:
+    Document* doc;
+};
+
 template<typename T>
 inline std::vector<T*> Document::getObjectsOfType() const
 {
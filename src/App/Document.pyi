@@ -219,6 +219,25 @@ class Document(PropertyContainer):
         """
         ...
 
+    def addObjects(
+        self,
+        types: str | Sequence[str],
+        names: Sequence[str] = None,
+    ) -> list[DocumentObject]:
+        """
+        Add many objects to the document at once.
+
+        All types are checked and all names are reserved before the first object is
+        created, and the view providers of the new objects are created in one pass.
+        Only the last object is activated.
+
+        Args:
+            types: the type of all objects, or a sequence with the type of each object.
+            names: the optional names of the new objects, one per object. An empty
+                   name is replaced by a unique name based on the type.
+        """
+        ...
+
     def addProperty(
         self,
         type: str,
@@ -371,6 +390,26 @@ class Document(PropertyContainer):
         """
         ...
 
+    def getRecomputeProfile(self) -> list[tuple[str, float, float]]:
+        """
+        Returns the name of each object of the last recompute with the total seconds
+        spent in it and the seconds spent in the object itself, slowest first.
+
+        The total time of an object includes the objects it recomputes while it is
+        recomputed, its self time does not.
+        """
+        ...
+
+    def exportRecomputeProfile(self, path: str = None, /) -> str | None:
+        """
+        Export the last recompute profile as Chrome trace events.
+
+        If path is passed, the trace is written to it. if not a string is returned.
+
+        The trace can be loaded in chrome://tracing or the Perfetto UI.
+        """
+        ...
+
     def mustExecute(self) -> bool:
         """
         Check if any object must be recomputed
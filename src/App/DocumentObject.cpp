@@ -24,11 +24,15 @@
  ***************************************************************************/
 
 #include <stack>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <set>
 #include <vector>
 #include <string>
+#include <utility>
 
 #include <Base/Console.h>
 #include <Base/Matrix.h>
@@ -60,6 +64,48 @@ PROPERTY_SOURCE(App::DocumentObject, App::TransactionalObject)
 
 DocumentObjectExecReturn* DocumentObject::StdReturn = nullptr;
 
+namespace
+{
+// Bumped on every change of an object that may affect the result of getSubObject()
+std::atomic<unsigned long> subObjectChangeCounter {1};
+// Bumped whenever an object is destroyed, as the cached paths hold plain pointers
+std::atomic<unsigned long> subObjectGeneration {1};
+// Guards the caches of all objects and subObjectGeneration, the lookups are short
+std::mutex subObjectCacheMutex;
+// Collects the objects entered by getSubObject() while getSubObjectCached() resolves a subname
+thread_local std::vector<const DocumentObject*>* subObjectPath = nullptr;
+
+bool hasPythonSubObject(const DocumentObject* obj)
+{
+    if (obj->getPropertyByName("Proxy")) {
+        return true;
+    }
+    for (auto ext : obj->getExtensionsDerivedFromType<DocumentObjectExtension>()) {
+        if (ext->isPythonExtension()) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+struct DocumentObject::SubObjectCache
+{
+    struct Entry
+    {
+        DocumentObject* obj;
+        Base::Matrix4D mat;
+        // the objects entered while resolving, including this one
+        std::vector<const DocumentObject*> path;
+        unsigned long stamp;
+        // offset of the element name in the subname
+        std::size_t elementPos;
+    };
+
+    std::map<std::pair<std::string, bool>, Entry> entries;
+    unsigned long generation {0};
+};
+
 //===========================================================================
 // DocumentObject
 //===========================================================================
@@ -85,6 +131,12 @@ DocumentObject::DocumentObject()
 
 DocumentObject::~DocumentObject()
 {
+    // the cached paths of all objects may point to this one
+    {
+        std::lock_guard<std::mutex> lock(subObjectCacheMutex);
+        ++subObjectGeneration;
+    }
+
     if (!PythonObject.is(Py::_None())) {
         Base::PyGILStateLocker lock;
         // Remark: The API of Py::Object has been changed to set whether the wrapper owns the passed
@@ -172,6 +224,9 @@ App::DocumentObjectExecReturn* DocumentObject::recompute()
         }
     }
 
+    // execute() may change the sub objects without changing a property
+    invalidateSubObjectCache();
+
     return ret;
 }
 
@@ -685,6 +740,7 @@ bool DocumentObject::removeDynamicProperty(const char* name)
     if (prop->isDerivedFrom<PropertyLinkBase>()) {
         clearOutListCache();
     }
+    invalidateSubObjectCache();
 
     _pDoc->addOrRemovePropertyOfObject(this, prop, false);
 
@@ -746,6 +802,9 @@ App::Property* DocumentObject::addDynamicProperty(const char* type,
                                                   bool hidden)
 {
     auto prop = TransactionalObject::addDynamicProperty(type, name, group, doc, attr, ro, hidden);
+    if (prop) {
+        invalidateSubObjectCache();
+    }
     if (prop && _pDoc) {
         _pDoc->addOrRemovePropertyOfObject(this, prop, true);
     }
@@ -858,6 +917,8 @@ void DocumentObject::onEarlyChange(const Property* prop)
 /// get called by the container when a Property was changed
 void DocumentObject::onChanged(const Property* prop)
 {
+    invalidateSubObjectCache();
+
     if (prop == &Label && _pDoc && _pDoc->containsObject(this) && oldLabel != Label.getStrValue()) {
         _pDoc->unregisterLabel(oldLabel);
         _pDoc->registerLabel(Label.getStrValue());
@@ -936,6 +997,10 @@ DocumentObject* DocumentObject::getSubObject(const char* subname,
                                              bool transform,
                                              int depth) const
 {
+    if (subObjectPath) {
+        subObjectPath->push_back(this);
+    }
+
     DocumentObject* ret = nullptr;
     auto exts = getExtensionsDerivedFromType<App::DocumentObjectExtension>();
     for (auto ext : exts) {
@@ -984,11 +1049,134 @@ DocumentObject* DocumentObject::getSubObject(const char* subname,
     }
 
     if (ret && dot) {
+        // ret may override getSubObject() and not pass by here
+        if (subObjectPath) {
+            subObjectPath->push_back(ret);
+        }
         return ret->getSubObject(dot + 1, pyObj, mat, true, depth + 1);
     }
     return ret;
 }
 
+void DocumentObject::invalidateSubObjectCache()
+{
+    _subObjectStamp = ++subObjectChangeCounter;
+}
+
+DocumentObject* DocumentObject::getSubObjectCached(const char* subname,
+                                                   Base::Matrix4D* mat,
+                                                   bool transform,
+                                                   const char** element) const
+{
+    // The cache of an object is bounded, a full cache starts over
+    constexpr std::size_t maxEntries = 1000;
+
+    if (!subname) {
+        subname = "";
+    }
+    auto key = std::make_pair(std::string(subname), transform);
+    const unsigned long stamp = subObjectChangeCounter;
+    unsigned long generation = 0;
+    {
+        // The generation is bumped under the lock before an object is destroyed, so
+        // the objects of an entry of the current generation stay alive while it is held
+        std::lock_guard<std::mutex> lock(subObjectCacheMutex);
+        generation = subObjectGeneration;
+        if (_subObjectCache && _subObjectCache->generation == generation) {
+            auto it = _subObjectCache->entries.find(key);
+            if (it != _subObjectCache->entries.end()) {
+                const auto& entry = it->second;
+                bool valid = std::all_of(entry.path.begin(), entry.path.end(), [&](auto obj) {
+                    return obj->_subObjectStamp <= entry.stamp;
+                });
+                if (valid) {
+                    if (mat) {
+                        *mat *= entry.mat;
+                    }
+                    if (element) {
+                        *element = subname + entry.elementPos;
+                    }
+                    return entry.obj;
+                }
+                _subObjectCache->entries.erase(it);
+            }
+        }
+    }
+
+    // Resolve once without holding the lock, getSubObject() may run arbitrary code.
+    // The objects entered on the way make up the path of the entry.
+    std::vector<const DocumentObject*> path {this};
+    Base::Matrix4D subMat;
+    DocumentObject* obj = nullptr;
+    {
+        auto outerPath = subObjectPath;
+        subObjectPath = &path;
+        try {
+            obj = getSubObject(subname, nullptr, &subMat, transform);
+        }
+        catch (...) {
+            subObjectPath = outerPath;
+            throw;
+        }
+        subObjectPath = outerPath;
+    }
+    if (mat) {
+        *mat *= subMat;
+    }
+    const std::size_t elementPos = Data::findElementName(subname) - subname;
+    if (element) {
+        *element = subname + elementPos;
+    }
+
+    if (obj) {
+        path.push_back(obj);
+    }
+    std::sort(path.begin(), path.end());
+    path.erase(std::unique(path.begin(), path.end()), path.end());
+    if (std::any_of(path.begin(), path.end(), hasPythonSubObject)) {
+        return obj;
+    }
+
+    std::lock_guard<std::mutex> lock(subObjectCacheMutex);
+    if (subObjectGeneration != generation) {
+        return obj;
+    }
+    if (!_subObjectCache) {
+        _subObjectCache = std::make_unique<SubObjectCache>();
+    }
+    if (_subObjectCache->generation != generation
+        || _subObjectCache->entries.size() >= maxEntries) {
+        _subObjectCache->entries.clear();
+        _subObjectCache->generation = generation;
+    }
+    _subObjectCache->entries[std::move(key)] =
+        SubObjectCache::Entry {obj, subMat, std::move(path), stamp, elementPos};
+    return obj;
+}
+
+std::vector<DocumentObject*>
+DocumentObject::getSubObjectsCached(const std::vector<std::string>& subnames,
+                                    std::vector<Base::Matrix4D>* mats,
+                                    bool transform,
+                                    std::vector<const char*>* elements) const
+{
+    std::vector<DocumentObject*> objs;
+    objs.reserve(subnames.size());
+    if (mats) {
+        mats->assign(subnames.size(), Base::Matrix4D());
+    }
+    if (elements) {
+        elements->assign(subnames.size(), nullptr);
+    }
+    for (std::size_t i = 0; i < subnames.size(); ++i) {
+        objs.push_back(getSubObjectCached(subnames[i].c_str(),
+                                          mats ? &(*mats)[i] : nullptr,
+                                          transform,
+                                          elements ? &(*elements)[i] : nullptr));
+    }
+    return objs;
+}
+
 namespace
 {
 std::vector<DocumentObject*>
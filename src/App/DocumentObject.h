@@ -34,6 +34,7 @@
 #include <Base/SmartPtrPy.h>
 #include <Base/Placement.h>
 
+#include <atomic>
 #include <bitset>
 #include <unordered_map>
 #include <memory>
@@ -799,6 +800,52 @@ public:
                                          bool transform = true,
                                          int depth = 0) const;
 
+    /**
+     * @brief Get the sub object by name, reusing earlier results.
+     *
+     * This gives the same result as getSubObject(). The resolved object, the
+     * accumulated transformation and the position of the element name are cached
+     * per subname and @p transform on this object. An entry is outdated as soon as
+     * one of the objects entered while resolving it is changed, see
+     * invalidateSubObjectCache(), or any object is destroyed. Paths through objects
+     * with a Python proxy or a Python extension are not cached, because their
+     * getSubObject() may depend on anything.
+     *
+     * @param[in] subname A dot separated name as for getSubObject().
+     * @param[in,out] mat If not null, it is multiplied with the accumulated
+     * transformation as in getSubObject().
+     * @param[in] transform: As for getSubObject().
+     * @param[out] element If not null, receives a pointer to the element name
+     * inside @p subname, see Data::findElementName().
+     *
+     * @return The last document object referred in subname, or @c nullptr.
+     */
+    DocumentObject* getSubObjectCached(const char* subname,
+                                       Base::Matrix4D* mat = nullptr,
+                                       bool transform = true,
+                                       const char** element = nullptr) const;
+
+    /**
+     * @brief Get the sub objects of a list of subnames, see getSubObjectCached().
+     *
+     * @param[in] subnames The dot separated names to resolve.
+     * @param[out] mats If not null, receives the accumulated transformation of
+     * each sub object.
+     * @param[in] transform: As for getSubObject().
+     * @param[out] elements If not null, receives a pointer to the element name
+     * inside each of @p subnames.
+     *
+     * @return The sub objects in the order of @p subnames, with @c nullptr for
+     * the names that cannot be resolved.
+     */
+    std::vector<DocumentObject*> getSubObjectsCached(const std::vector<std::string>& subnames,
+                                                     std::vector<Base::Matrix4D>* mats = nullptr,
+                                                     bool transform = true,
+                                                     std::vector<const char*>* elements = nullptr) const;
+
+    /// Outdate the cached results of getSubObjectCached() whose path passes this object
+    void invalidateSubObjectCache();
+
     /**
      * @brief Get a list of objects referenced by a given subname.
      *
@@ -1380,6 +1427,12 @@ private:
     mutable std::unordered_map<const char*, App::DocumentObject*, CStringHasher, CStringHasher>
         _outListMap;
     mutable bool _outListCached = false;
+
+    // the cached results of getSubObjectCached()
+    struct SubObjectCache;
+    mutable std::unique_ptr<SubObjectCache> _subObjectCache;
+    // the value of the global change counter at the last change of this object
+    std::atomic<unsigned long> _subObjectStamp {0};
 };
 
 }  // namespace App
@@ -192,6 +192,25 @@ class DocumentObject(ExtensionContainer):
         """
         ...
 
+    def getSubObjectsCached(
+        self,
+        subnames: Union[List[str], Tuple[str, ...]],
+        *,
+        transform: bool = True,
+    ) -> List[Tuple[Any, Matrix, str]]:
+        """
+        Resolve a list of subnames like getSubObject(), reusing earlier results.
+
+        * subnames(list|tuple): dot separated strings referencing subobjects.
+
+        * transform: whether to transform the sub objects using this object's placement
+
+        Returns a list with a tuple (object, matrix, element) for each subname. 'object'
+        is None if the subname cannot be resolved, 'matrix' is the accumulated
+        transformation and 'element' the element name at the end of the subname.
+        """
+        ...
+
     def getSubObjectList(self, subname: str, /) -> list:
         """
         Return a list of objects referenced by a given subname including this object
@@ -662,6 +662,58 @@ PyObject* DocumentObjectPy::getSubObject(PyObject* args, PyObject* keywds)
     PY_CATCH
 }
 
+PyObject* DocumentObjectPy::getSubObjectsCached(PyObject* args, PyObject* keywds)
+{
+    PyObject* obj;
+    PyObject* doTransform = Py_True;
+
+    static const std::array<const char*, 3> kwlist {"subnames", "transform", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             keywds,
+                                             "O|O!",
+                                             kwlist,
+                                             &obj,
+                                             &PyBool_Type,
+                                             &doTransform)) {
+        return nullptr;
+    }
+
+    if (PyUnicode_Check(obj) || !PySequence_Check(obj)) {
+        PyErr_SetString(PyExc_TypeError, "subnames must be a sequence of string");
+        return nullptr;
+    }
+    std::vector<std::string> subs;
+    Py::Sequence seq(obj);
+    for (Py::Sequence::iterator it = seq.begin(); it != seq.end(); ++it) {
+        PyObject* item = (*it).ptr();
+        if (!PyUnicode_Check(item)) {
+            PyErr_SetString(PyExc_TypeError, "non-string object in sequence");
+            return nullptr;
+        }
+        subs.emplace_back(PyUnicode_AsUTF8(item));
+    }
+
+    PY_TRY
+    {
+        std::vector<Base::Matrix4D> mats;
+        std::vector<const char*> elements;
+        auto objs = getDocumentObjectPtr()->getSubObjectsCached(subs,
+                                                                &mats,
+                                                                Base::asBoolean(doTransform),
+                                                                &elements);
+        Py::List res;
+        for (std::size_t i = 0; i < objs.size(); ++i) {
+            Py::Tuple item(3);
+            item.setItem(0, objs[i] ? Py::asObject(objs[i]->getPyObject()) : Py::None());
+            item.setItem(1, Py::Matrix(mats[i]));
+            item.setItem(2, Py::String(elements[i]));
+            res.append(item);
+        }
+        return Py::new_reference_to(res);
+    }
+    PY_CATCH
+}
+
 PyObject* DocumentObjectPy::getSubObjectList(PyObject* args)
 {
     const char* subname;
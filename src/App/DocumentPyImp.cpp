@@ -22,6 +22,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
 #include <Base/Stream.h>
@@ -418,6 +420,58 @@ PyObject* DocumentPy::addObject(PyObject* args, PyObject* kwd)
     return pcFtr->getPyObject();
 }
 
+PyObject* DocumentPy::addObjects(PyObject* args, PyObject* kwd)
+{
+    PyObject* pyTypes {};
+    PyObject* pyNames = Py_None;
+    static const std::array<const char*, 3> kwlist {"types", "names", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args, kwd, "O|O", kwlist, &pyTypes, &pyNames)) {
+        return nullptr;
+    }
+
+    auto toStrings = [](PyObject* pyobj, const char* what) {
+        if (PyUnicode_Check(pyobj) || !PySequence_Check(pyobj)) {
+            std::stringstream str;
+            str << "Expect a sequence of str for " << what;
+            throw Py::TypeError(str.str());
+        }
+        std::vector<std::string> values;
+        Py::Sequence seq(pyobj);
+        values.reserve(seq.size());
+        for (Py_ssize_t i = 0; i < seq.size(); ++i) {
+            if (!PyUnicode_Check(seq[i].ptr())) {
+                std::stringstream str;
+                str << "Expect element in " << what << " to be of type str";
+                throw Py::TypeError(str.str());
+            }
+            values.push_back(PyUnicode_AsUTF8(seq[i].ptr()));
+        }
+        return values;
+    };
+
+    std::vector<std::string> names;
+    if (pyNames != Py_None) {
+        names = toStrings(pyNames, "names");
+    }
+
+    std::vector<std::string> types;
+    if (PyUnicode_Check(pyTypes)) {
+        // one type for all objects
+        types.assign(std::max<std::size_t>(names.size(), 1), PyUnicode_AsUTF8(pyTypes));
+    }
+    else {
+        types = toStrings(pyTypes, "types");
+    }
+
+    auto objects = getDocumentPtr()->addObjects(types, names);
+
+    Py::List list;
+    for (auto* obj : objects) {
+        list.append(Py::asObject(obj->getPyObject()));
+    }
+    return Py::new_reference_to(list);
+}
+
 PyObject* DocumentPy::removeObject(PyObject* args)
 {
     char* sName {};
@@ -762,6 +816,47 @@ PyObject* DocumentPy::recompute(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* DocumentPy::getRecomputeProfile(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    auto profile = getDocumentPtr()->getRecomputeProfile();
+    std::stable_sort(profile.begin(), profile.end(), [](const auto& a, const auto& b) {
+        return a.total > b.total;
+    });
+
+    Py::List list;
+    for (const auto& entry : profile) {
+        list.append(
+            Py::TupleN(Py::String(entry.name), Py::Float(entry.total), Py::Float(entry.self)));
+    }
+    return Py::new_reference_to(list);
+}
+
+PyObject* DocumentPy::exportRecomputeProfile(PyObject* args)
+{
+    char* fn = nullptr;
+    if (!PyArg_ParseTuple(args, "|s", &fn)) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        if (fn) {
+            Base::FileInfo fi(fn);
+            Base::ofstream str(fi);
+            getDocumentPtr()->exportRecomputeProfile(str);
+            str.close();
+            Py_Return;
+        }
+        std::stringstream str;
+        getDocumentPtr()->exportRecomputeProfile(str);
+        return Py::new_reference_to(Py::String(str.str()));
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::mustExecute(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -154,7 +154,7 @@ DocumentObject* GeoFeature::resolveElement(const DocumentObject* obj,
     if (element) {
         *element = foundElement;
     }
-    auto sobj = obj->getSubObject(std::string(subname, foundElement).c_str());
+    auto sobj = obj->getSubObjectCached(std::string(subname, foundElement).c_str());
     if (!sobj) {
         return nullptr;
     }
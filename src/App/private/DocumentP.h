@@ -45,6 +45,7 @@
 #include <App/DocumentObserver.h>
 #include <App/StringHasher.h>
 #include <App/ExportInfo.h>
+#include <Base/TimeInfo.h>
 #include <Base/UniqueNameManager.h>
 
 // using VertexProperty = boost::property<boost::vertex_root_t, DocumentObject* >;
@@ -98,17 +99,61 @@ struct DocumentP
     // Id and name that the next transaction will take
     // as soon as there is a change to the document
     int bookedTransaction { 0 }; 
+    // Nesting level of BulkObjectCreation
+    int bulkCreation {0};
+    // Id of the objects added during a bulk creation
+    std::vector<long> bulkNewObjects;
+    // Id of the object to activate when the bulk creation ends
+    long bulkActiveObject {0};
 
     std::string programVersion;
     mutable HasherMap hashers;
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
         _RecomputeLog;
+    // Time spent in each object of the last recompute
+    std::vector<Document::RecomputeProfileEntry> recomputeProfile;
+    // Start of the last recompute, the profile entries start relative to it
+    Base::TimeElapsed recomputeProfileStart;
+    // Profile entries of the objects that are being recomputed, innermost last
+    std::vector<std::size_t> recomputeProfileStack;
     ExportInfo exportInfo;
 
     StringHasherRef Hasher {new StringHasher};
 
     DocumentP();
 
+    void clearRecomputeProfile()
+    {
+        recomputeProfile.clear();
+        recomputeProfileStack.clear();
+        recomputeProfileStart.setCurrent();
+    }
+
+    void beginRecomputeProfile(const char* name)
+    {
+        Document::RecomputeProfileEntry entry;
+        entry.name = name;
+        entry.start = Base::TimeElapsed::diffTimeF(recomputeProfileStart);
+        entry.depth = static_cast<int>(recomputeProfileStack.size());
+        recomputeProfileStack.push_back(recomputeProfile.size());
+        recomputeProfile.push_back(std::move(entry));
+    }
+
+    void endRecomputeProfile()
+    {
+        if (recomputeProfileStack.empty()) {
+            return;
+        }
+        auto& entry = recomputeProfile[recomputeProfileStack.back()];
+        recomputeProfileStack.pop_back();
+        entry.total = Base::TimeElapsed::diffTimeF(recomputeProfileStart) - entry.start;
+        // the nested entries have already taken their total off the self time
+        entry.self += entry.total;
+        if (!recomputeProfileStack.empty()) {
+            recomputeProfile[recomputeProfileStack.back()].self -= entry.total;
+        }
+    }
+
     void addRecomputeLog(const char* why, App::DocumentObject* obj)
     {
         addRecomputeLog(new DocumentObjectExecReturn(why, obj));
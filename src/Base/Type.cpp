@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <cassert>
+#include <utility>
 
 #include "Type.h"
 #include "Interpreter.h"
@@ -46,17 +47,27 @@ static_assert(
 
 struct Base::TypeData
 {
-    TypeData(const char* name, const Type type, const Type parent, const Type::instantiationMethod instMethod)
+    TypeData(
+        const char* name,
+        const Type type,
+        const Type parent,
+        const Type::instantiationMethod instMethod,
+        std::vector<Type> ancestry
+    )
         : name(name)
         , parent(parent)
         , type(type)
         , instMethod(instMethod)
+        , ancestry(std::move(ancestry))
     {}
 
     const std::string name;
     const Type parent;
     const Type type;
     const Type::instantiationMethod instMethod;
+    // The chain of types from the root down to this type. A type is derived from the type
+    // found at its own depth in this chain, which makes isDerivedFrom() a single lookup.
+    const std::vector<Type> ancestry;
 };
 
 namespace
@@ -143,7 +154,14 @@ const Type Type::createType(const Type parent, const char* name, instantiationMe
 
     Type newType;
     newType.index = static_cast<unsigned int>(Type::typedata.size());
-    Type::typedata.emplace_back(new TypeData(name, newType, parent, method));
+
+    // super classes are registered before their derived classes
+    std::vector<Type> ancestry;
+    if (!parent.isBad()) {
+        ancestry = typedata[parent.index]->ancestry;
+    }
+    ancestry.push_back(newType);
+    Type::typedata.emplace_back(new TypeData(name, newType, parent, method, std::move(ancestry)));
 
     // add to dictionary for fast lookup
     Type::typemap.emplace(name, newType.getKey());
@@ -155,7 +173,7 @@ const Type Type::createType(const Type parent, const char* name, instantiationMe
 void Type::init()
 {
     assert(Type::typedata.size() == 0 && "Type::init() should only be called once");
-    typedata.emplace_back(new TypeData(BadTypeName, BadType, BadType, nullptr));
+    typedata.emplace_back(new TypeData(BadTypeName, BadType, BadType, nullptr, {}));
     typemap[BadTypeName] = 0;
 }
 
@@ -206,15 +224,13 @@ const Type Type::getParent() const
 
 bool Type::isDerivedFrom(const Type type) const
 {
-    Type temp(*this);
-    do {
-        if (temp == type) {
-            return true;
-        }
-        temp = temp.getParent();
-    } while (!temp.isBad());
+    if (isBad() || type.isBad()) {
+        return index == type.index;
+    }
 
-    return false;
+    const auto& ancestry = typedata[index]->ancestry;
+    const auto depth = typedata[type.index]->ancestry.size() - 1;
+    return depth < ancestry.size() && ancestry[depth] == type;
 }
 
 int Type::getAllDerivedFrom(const Type type, std::vector<Type>& list)
@@ -27,6 +27,7 @@
 #include <map>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <cctype>
 #include <mutex>
@@ -117,10 +118,16 @@ struct DocumentP
     std::map<SoSeparator*, ViewProviderDocumentObject*> _CoinMap;
     std::map<std::string, ViewProvider*> _ViewProviderMapAnnotation;
     std::list<ViewProviderDocumentObject*> _redoViewProviders;
+    // objects whose view providers were created by slotNewObjects()
+    std::unordered_set<const App::DocumentObject*> _bulkNewObjects;
+    // objects added to a transaction during a bulk creation before their view
+    // provider exists, the entry is dropped when the object leaves the transaction
+    std::unordered_map<const App::DocumentObject*, App::Transaction*> _bulkTransactions;
 
     using Connection = fastsignals::connection;
     using AdvancedConnection = fastsignals::advanced_connection;
     Connection connectNewObject;
+    Connection connectNewObjects;
     Connection connectDelObject;
     Connection connectCngObject;
     Connection connectRenObject;
@@ -453,6 +460,9 @@ Document::Document(App::Document* pcDocument, Application* app)
     d->connectNewObject = pcDocument->signalNewObject.connect(
         std::bind(&Gui::Document::slotNewObject, this, sp::_1)
     );
+    d->connectNewObjects = pcDocument->signalNewObjects.connect(
+        std::bind(&Gui::Document::slotNewObjects, this, sp::_1)
+    );
     d->connectDelObject = pcDocument->signalDeletedObject.connect(
         std::bind(&Gui::Document::slotDeletedObject, this, sp::_1)
     );
@@ -552,6 +562,7 @@ Document::~Document()
     // disconnect everything to avoid to be double-deleted
     // in case an exception is raised somewhere
     d->connectNewObject.disconnect();
+    d->connectNewObjects.disconnect();
     d->connectDelObject.disconnect();
     d->connectCngObject.disconnect();
     d->connectRenObject.disconnect();
@@ -959,63 +970,89 @@ void Document::setPos(const char* name, const Base::Matrix4D& rclMtrx)
 //*****************************************************************************************************
 // Document
 //*****************************************************************************************************
-void Document::slotNewObject(const App::DocumentObject& Obj)
-{
-    auto pcProvider = static_cast<ViewProviderDocumentObject*>(getViewProvider(&Obj));
-    if (!pcProvider) {
-        std::string cName = Obj.getViewProviderNameStored();
-        for (;;) {
-            if (cName.empty()) {
-                // handle document object with no view provider specified
-                FC_LOG(Obj.getFullName() << " has no view provider specified");
-                return;
-            }
-            Base::Type type = Base::Type::getTypeIfDerivedFrom(
-                cName.c_str(),
-                ViewProviderDocumentObject::getClassTypeId(),
-                true
-            );
-            pcProvider = static_cast<ViewProviderDocumentObject*>(type.createInstance());
-            // createInstance could return a null pointer
-            if (!pcProvider) {
-                // type not derived from ViewProviderDocumentObject!!!
-                FC_ERR("Invalid view provider type '" << cName << "' for " << Obj.getFullName());
-                return;
-            }
-            else if (cName != Obj.getViewProviderName() && !pcProvider->allowOverride(Obj)) {
-                FC_WARN("View provider type '" << cName << "' does not support " << Obj.getFullName());
-                delete pcProvider;
-                pcProvider = nullptr;
-                cName = Obj.getViewProviderName();
-            }
-            else {
-                break;
-            }
+ViewProviderDocumentObject* Document::createViewProvider(const App::DocumentObject& Obj)
+{
+    ViewProviderDocumentObject* pcProvider = nullptr;
+    std::string cName = Obj.getViewProviderNameStored();
+    for (;;) {
+        if (cName.empty()) {
+            // handle document object with no view provider specified
+            FC_LOG(Obj.getFullName() << " has no view provider specified");
+            return nullptr;
+        }
+        Base::Type type = Base::Type::getTypeIfDerivedFrom(
+            cName.c_str(),
+            ViewProviderDocumentObject::getClassTypeId(),
+            true
+        );
+        pcProvider = static_cast<ViewProviderDocumentObject*>(type.createInstance());
+        // createInstance could return a null pointer
+        if (!pcProvider) {
+            // type not derived from ViewProviderDocumentObject!!!
+            FC_ERR("Invalid view provider type '" << cName << "' for " << Obj.getFullName());
+            return nullptr;
+        }
+        else if (cName != Obj.getViewProviderName() && !pcProvider->allowOverride(Obj)) {
+            FC_WARN("View provider type '" << cName << "' does not support " << Obj.getFullName());
+            delete pcProvider;
+            pcProvider = nullptr;
+            cName = Obj.getViewProviderName();
         }
+        else {
+            break;
+        }
+    }
 
-        setModified(true);
-        d->_ViewProviderMap[&Obj] = pcProvider;
-        d->_CoinMap[pcProvider->getRoot()] = pcProvider;
-        pcProvider->setStatus(Gui::ViewStatus::TouchDocument, d->_changeViewTouchDocument);
+    setModified(true);
+    d->_ViewProviderMap[&Obj] = pcProvider;
+    d->_CoinMap[pcProvider->getRoot()] = pcProvider;
+    pcProvider->setStatus(Gui::ViewStatus::TouchDocument, d->_changeViewTouchDocument);
 
-        try {
-            // if successfully created set the right name and calculate the view
-            // FIXME: Consider to change argument of attach() to const pointer
-            pcProvider->attach(const_cast<App::DocumentObject*>(&Obj));
-            pcProvider->updateView();
-            pcProvider->setActiveMode();
-        }
-        catch (const Base::MemoryException& e) {
-            FC_ERR("Memory exception in " << Obj.getFullName() << " thrown: " << e.what());
-        }
-        catch (Base::Exception& e) {
-            e.reportException();
-        }
+    try {
+        // if successfully created set the right name and calculate the view
+        // FIXME: Consider to change argument of attach() to const pointer
+        pcProvider->attach(const_cast<App::DocumentObject*>(&Obj));
+        pcProvider->updateView();
+        pcProvider->setActiveMode();
+    }
+    catch (const Base::MemoryException& e) {
+        FC_ERR("Memory exception in " << Obj.getFullName() << " thrown: " << e.what());
+    }
+    catch (Base::Exception& e) {
+        e.reportException();
+    }
 #ifndef FC_DEBUG
-        catch (...) {
-            FC_ERR("Unknown exception in Feature " << Obj.getFullName() << " thrown");
-        }
+    catch (...) {
+        FC_ERR("Unknown exception in Feature " << Obj.getFullName() << " thrown");
+    }
 #endif
+
+    return pcProvider;
+}
+
+void Document::finishNewViewProvider(ViewProviderDocumentObject* pcProvider)
+{
+    // adding to the tree
+    signalNewObject(*pcProvider);
+    pcProvider->pcDocument = this;
+
+    // it is possible that a new viewprovider already claims children
+    handleChildren3D(pcProvider);
+    if (d->_isTransacting) {
+        d->_redoViewProviders.push_back(pcProvider);
+    }
+}
+
+void Document::slotNewObject(const App::DocumentObject& Obj)
+{
+    // the view provider was already created by slotNewObjects()
+    if (d->_bulkNewObjects.erase(&Obj) != 0) {
+        return;
+    }
+
+    auto pcProvider = static_cast<ViewProviderDocumentObject*>(getViewProvider(&Obj));
+    if (!pcProvider) {
+        pcProvider = createViewProvider(Obj);
     }
     else {
         try {
@@ -1035,21 +1072,54 @@ void Document::slotNewObject(const App::DocumentObject& Obj)
             }
         }
 
-        // adding to the tree
-        signalNewObject(*pcProvider);
-        pcProvider->pcDocument = this;
+        finishNewViewProvider(pcProvider);
+    }
+}
+
+void Document::slotNewObjects(const std::vector<App::DocumentObject*>& objs)
+{
+    // Create all view providers first, so that the views are only updated
+    // once and the parents find their children when claiming them. Objects
+    // with an existing view provider are left to slotNewObject().
+    std::vector<ViewProvider*> providers;
+    providers.reserve(objs.size());
+    for (auto* obj : objs) {
+        if (getViewProvider(obj)) {
+            continue;
+        }
+        auto pcProvider = createViewProvider(*obj);
+        if (pcProvider) {
+            providers.push_back(pcProvider);
+        }
+        d->_bulkNewObjects.insert(obj);
+
+        // add the view provider to the transaction the object was appended to
+        auto it = d->_bulkTransactions.find(obj);
+        if (it != d->_bulkTransactions.end()) {
+            if (pcProvider) {
+                it->second->addObjectDel(pcProvider);
+            }
+            d->_bulkTransactions.erase(it);
+        }
+    }
 
-        // it is possible that a new viewprovider already claims children
-        handleChildren3D(pcProvider);
-        if (d->_isTransacting) {
-            d->_redoViewProviders.push_back(pcProvider);
+    for (auto* v : d->baseViews) {
+        auto activeView = dynamic_cast<View3DInventor*>(v);
+        if (activeView) {
+            activeView->getViewer()->addViewProviders(providers);
         }
     }
+
+    for (auto* pcProvider : providers) {
+        finishNewViewProvider(static_cast<ViewProviderDocumentObject*>(pcProvider));
+    }
 }
 
 void Document::slotDeletedObject(const App::DocumentObject& Obj)
 {
     setModified(true);
+    d->_bulkNewObjects.erase(&Obj);
+    d->_bulkTransactions.erase(&Obj);
 
     // cycling to all views of the document
     ViewProvider* viewProvider = getViewProvider(&Obj);
@@ -1162,10 +1232,16 @@ void Document::slotTransactionAppend(const App::DocumentObject& obj, App::Transa
     if (viewProvider && viewProvider->isDerivedFrom<ViewProviderDocumentObject>()) {
         transaction->addObjectDel(viewProvider);
     }
+    else if (!viewProvider && obj.getDocument() && obj.getDocument()->isBulkCreation()) {
+        // the view provider is only created when the bulk creation ends
+        d->_bulkTransactions[&obj] = transaction;
+    }
 }
 
 void Document::slotTransactionRemove(const App::DocumentObject& obj, App::Transaction* transaction)
 {
+    d->_bulkTransactions.erase(&obj);
+
     std::map<const App::DocumentObject*, ViewProviderDocumentObject*>::const_iterator it
         = d->_ViewProviderMap.find(&obj);
     if (it != d->_ViewProviderMap.end()) {
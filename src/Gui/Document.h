@@ -85,6 +85,8 @@ protected:
     //@{
     /// This slot is connected to the App::Document::signalNewObject(...)
     void slotNewObject(const App::DocumentObject&);
+    /// This slot is connected to the App::Document::signalNewObjects(...)
+    void slotNewObjects(const std::vector<App::DocumentObject*>&);
     void slotDeletedObject(const App::DocumentObject&);
     void slotChangedObject(const App::DocumentObject&, const App::Property&);
     void slotRelabelObject(const App::DocumentObject&);
@@ -357,6 +359,10 @@ private:
     void resetIfEditing();
     // handles the scene graph nodes to correctly group child and parents
     void handleChildren3D(ViewProvider* viewProvider, bool deleting = false);
+    // creates and attaches the view provider of a new object
+    ViewProviderDocumentObject* createViewProvider(const App::DocumentObject& Obj);
+    // adds a new view provider to the tree and the scene graph of its parent
+    void finishNewViewProvider(ViewProviderDocumentObject* pcProvider);
 
     /// Check other documents for the same transaction ID
     bool checkTransactionID(bool undo, int iSteps);
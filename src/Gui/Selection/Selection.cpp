@@ -1377,7 +1377,8 @@ void SelectionSingleton::selStackGoBack(int count, const char* pDocName)
     while (!context.info->selStackBack.empty()) {
         bool found = false;
         for (auto& sobjT : context.info->selStackBack.back()) {
-            if (sobjT.getSubObject()) {
+            auto obj = sobjT.getObject();
+            if (obj && obj->getSubObjectCached(sobjT.getSubName().c_str())) {
                 addSelection(
                     sobjT.getDocumentName().c_str(),
                     sobjT.getObjectName().c_str(),
@@ -1422,7 +1423,8 @@ void SelectionSingleton::selStackGoForward(int count, const char* pDocName)
     while (true) {
         bool found = false;
         for (auto& sobjT : context.info->selStackBack.back()) {
-            if (sobjT.getSubObject()) {
+            auto obj = sobjT.getObject();
+            if (obj && obj->getSubObjectCached(sobjT.getSubName().c_str())) {
                 addSelection(
                     sobjT.getDocumentName().c_str(),
                     sobjT.getObjectName().c_str(),
@@ -180,7 +180,7 @@ void SelectionView::onSelectionChanged(const SelectionChanges& Reason)
             if (elementName.newName.size() > 0) {
                 str << " []";
             }
-            auto subObj = obj->getSubObject(subName);
+            auto subObj = obj->getSubObjectCached(subName);
             if (subObj) {
                 obj = subObj;
             }
@@ -763,7 +763,7 @@ void SelectionMenu::processSelections(
         App::DocumentObject* sobj = sel.obj;
         bool usedFallback = false;
         if (!sel.subName.empty()) {
-            App::DocumentObject* resolved = sel.obj->getSubObject(sel.subName.c_str());
+            App::DocumentObject* resolved = sel.obj->getSubObjectCached(sel.subName.c_str());
             if (resolved) {
                 sobj = resolved;
             }
@@ -34,6 +34,7 @@
 #include <QPainter>
 #include <QPixmap>
 #include <QProcess>
+#include <QScrollBar>
 #include <QThread>
 #include <QTimer>
 #include <QToolTip>
@@ -130,6 +131,19 @@ void TreeParams::onItemBackgroundChanged()
 
 //////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+enum Status
+{
+    Visible = 1 << 0,
+    Recompute = 1 << 1,
+    Error = 1 << 2,
+    Hidden = 1 << 3,
+    External = 1 << 4,
+    Freezed = 1 << 5
+};
+}
+
 using DocumentObjectItems = std::set<DocumentObjectItem*>;
 
 class Gui::DocumentObjectData
@@ -147,6 +161,10 @@ public:
     std::string label;
     std::string label2;
     std::string internalName;
+    // Status bits that are the same for all items of the object, valid for
+    // one status update of the tree
+    int objectStatus {0};
+    unsigned statusGeneration {0};
 
     using Connection = fastsignals::scoped_connection;
 
@@ -284,6 +302,23 @@ public:
         return updated;
     }
 
+    int getObjectStatus(unsigned generation, bool refresh)
+    {
+        if (refresh || statusGeneration != generation) {
+            statusGeneration = generation;
+            auto obj = viewObject->getObject();
+            auto linked = obj->getLinkedObject(false);
+            bool external = viewObject->getDocument() != docItem->document()
+                || (linked && linked->getDocument() != obj->getDocument());
+            objectStatus = (obj->isFreezed() ? Status::Freezed : 0)
+                | (external ? Status::External : 0)
+                | (viewObject->showInTree() ? 0 : Status::Hidden)
+                | (obj->isError() ? Status::Error : 0)
+                | (obj->isTouched() || obj->mustExecute() == 1 ? Status::Recompute : 0);
+        }
+        return objectStatus;
+    }
+
     void testStatus(bool resetStatus = false)
     {
         QIcon icon, icon2;
@@ -720,6 +755,9 @@ TreeWidget::TreeWidget(const char* name, QWidget* parent)
     this->selectTimer->setSingleShot(true);
 
     connect(this->statusTimer, &QTimer::timeout, this, &TreeWidget::onUpdateStatus);
+    connect(verticalScrollBar(), &QScrollBar::valueChanged, this, [this]() {
+        updateVisibleItemStatus();
+    });
     connect(this, &QTreeWidget::itemEntered, this, &TreeWidget::onItemEntered);
     connect(this, &QTreeWidget::itemCollapsed, this, &TreeWidget::onItemCollapsed);
     connect(this, &QTreeWidget::itemExpanded, this, &TreeWidget::onItemExpanded);
@@ -1399,6 +1437,13 @@ void TreeWidget::hideEvent(QHideEvent* ev)
 void TreeWidget::showEvent(QShowEvent* ev)
 {
     QTreeWidget::showEvent(ev);
+    updateVisibleItemStatus();
+}
+
+void TreeWidget::resizeEvent(QResizeEvent* ev)
+{
+    QTreeWidget::resizeEvent(ev);
+    updateVisibleItemStatus();
 }
 
 void TreeWidget::onCreateGroup()
@@ -3545,9 +3590,8 @@ void TreeWidget::onUpdateStatus()
     }
 
     FC_LOG("update item status");
-    for (auto pos = DocumentMap.begin(); pos != DocumentMap.end(); ++pos) {
-        pos->second->testStatus();
-    }
+    ++statusGeneration;
+    updateVisibleItemStatus();
 
     // Checking for just restored documents
     for (auto& v : DocumentMap) {
@@ -3730,6 +3774,7 @@ void TreeWidget::onItemCollapsed(QTreeWidgetItem* item)
     if (item && item->type() == TreeWidget::ObjectType) {
         static_cast<DocumentObjectItem*>(item)->setExpandedStatus(false);
     }
+    updateVisibleItemStatus();
 }
 
 void TreeWidget::onItemExpanded(QTreeWidgetItem* item)
@@ -3740,6 +3785,32 @@ void TreeWidget::onItemExpanded(QTreeWidgetItem* item)
         objItem->setExpandedStatus(true);
         objItem->getOwnerDocument()->populateItem(objItem, false, false);
     }
+    updateVisibleItemStatus();
+}
+
+void TreeWidget::updateVisibleItemStatus()
+{
+    // Only the rows in the viewport are tested. The other items keep their
+    // status generation and are tested once they are scrolled into view or
+    // their parent is expanded, so that large documents do not pay for every
+    // item after each recompute.
+    if (!isVisible()) {
+        return;
+    }
+
+    QTreeWidgetItem* last = itemAt(0, viewport()->height() - 1);
+    for (auto item = itemAt(0, 0); item; item = itemBelow(item)) {
+        if (item->type() == ObjectType) {
+            auto objItem = static_cast<DocumentObjectItem*>(item);
+            if (objItem->statusGeneration != statusGeneration) {
+                QIcon icon, icon2;
+                objItem->testStatus(false, icon, icon2);
+            }
+        }
+        if (item == last) {
+            break;
+        }
+    }
 }
 
 void TreeWidget::scrollItemToTop()
@@ -5423,6 +5494,8 @@ Gui::Document* DocumentItem::document() const
 
 void DocumentItem::testStatus()
 {
+    auto tree = getTree();
+    ++tree->statusGeneration;
     for (const auto& v : ObjectMap) {
         v.second->testStatus();
     }
@@ -6048,6 +6121,7 @@ DocumentObjectItem::DocumentObjectItem(DocumentItem* ownerDocItem, DocumentObjec
     , myOwner(ownerDocItem)
     , myData(data)
     , previousStatus(-1)
+    , statusGeneration(0)
     , selected(0)
     , populated(false)
 {
@@ -6177,19 +6251,6 @@ void DocumentObjectItem::testStatus(bool resetStatus)
     }
 }
 
-namespace
-{
-enum Status
-{
-    Visible = 1 << 0,
-    Recompute = 1 << 1,
-    Error = 1 << 2,
-    Hidden = 1 << 3,
-    External = 1 << 4,
-    Freezed = 1 << 5
-};
-}
-
 void DocumentObjectItem::testStatus(bool resetStatus, QIcon& icon1, QIcon& icon2)
 {
     // guard against calling this during destruction when tree widget may be nullptr
@@ -6226,16 +6287,9 @@ void DocumentObjectItem::testStatus(bool resetStatus, QIcon& icon1, QIcon& icon2
         visible = object()->isShow() ? 1 : 0;
     }
 
-    auto obj = object()->getObject();
-    auto linked = obj->getLinkedObject(false);
-    bool external = object()->getDocument() != getOwnerDocument()->document()
-        || (linked && linked->getDocument() != obj->getDocument());
-    bool freezed = pObject->isFreezed();
-
-    int currentStatus = ((freezed ? 1 : 0) << 5) | ((external ? 1 : 0) << 4)
-        | ((object()->showInTree() ? 0 : 1) << 3) | ((pObject->isError() ? 1 : 0) << 2)
-        | ((pObject->isTouched() || pObject->mustExecute() == 1 ? 1 : 0) << 1) | (visible ? 1 : 0);
-
+    auto tree = getTree();
+    statusGeneration = tree->statusGeneration;
+    int currentStatus = myData->getObjectStatus(statusGeneration, resetStatus) | (visible ? 1 : 0);
 
     if (!resetStatus && previousStatus == currentStatus) {
         return;
@@ -194,10 +194,13 @@ protected:
 
     void showEvent(QShowEvent* ev) override;
     void hideEvent(QHideEvent* ev) override;
+    void resizeEvent(QResizeEvent* ev) override;
     void leaveEvent(QEvent* event) override;
 
 private:
     void _updateStatus(bool delay = true);
+    // test the status of the items in the viewport that are out of date
+    void updateVisibleItemStatus();
 
     // Helpers for the two-stage "Select All" feature
     void selectGroupItems(const QTreeWidgetItem* group, bool recursive);
@@ -314,6 +317,8 @@ private:
 
     std::string myName;  // for debugging purpose
     int updateBlocked = 0;
+    // incremented by each status update, items with an older value are out of date
+    unsigned statusGeneration = 1;
 
     // State tracking for the two-stage "Select All" operation
     bool lastSelectAllParent = false;   // true if last select was group-level, used for double-tap
@@ -559,6 +564,7 @@ private:
     std::vector<std::string> mySubs;
     using Connection = fastsignals::connection;
     int previousStatus;
+    unsigned statusGeneration;
     int selected;
     bool populated;
 
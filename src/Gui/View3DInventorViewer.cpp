@@ -35,6 +35,8 @@
 # include <GL/glu.h>
 #endif
 
+#include <array>
+
 #include <fmt/format.h>
 
 #include <Inventor/SbBox.h>
@@ -995,6 +997,28 @@ void View3DInventorViewer::addViewProvider(ViewProvider* pcProvider)
     _ViewProviderSet.insert(pcProvider);
 }
 
+void View3DInventorViewer::addViewProviders(const std::vector<ViewProvider*>& providers)
+{
+    if (providers.empty()) {
+        return;
+    }
+
+    std::array<SoGroup*, 4> groups {objectGroup, pcViewProviderRoot, foregroundroot, backgroundroot};
+    std::array<SbBool, 4> autonotify {};
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        autonotify[i] = groups[i]->enableNotify(FALSE);
+    }
+
+    for (auto* pcProvider : providers) {
+        addViewProvider(pcProvider);
+    }
+
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        groups[i]->enableNotify(autonotify[i]);
+        groups[i]->touch();
+    }
+}
+
 void View3DInventorViewer::removeViewProvider(ViewProvider* pcProvider)
 {
     if (this->editViewProvider == pcProvider) {
@@ -251,6 +251,8 @@ public:
     bool containsViewProvider(const ViewProvider*) const;
     /// adds an ViewProvider to the view, e.g. from a feature
     void addViewProvider(ViewProvider*);
+    /// adds many ViewProviders at once and notifies the scene graph only once
+    void addViewProviders(const std::vector<ViewProvider*>&);
     /// remove a ViewProvider
     void removeViewProvider(ViewProvider*);
     /// get view provider by path
@@ -42,6 +42,7 @@
 #include <Inventor/nodes/SoAnnotation.h>
 #include <Inventor/nodes/SoCube.h>
 #include <Inventor/nodes/SoDrawStyle.h>
+#include <Inventor/nodes/SoMatrixTransform.h>
 #include <Inventor/nodes/SoPickStyle.h>
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoShapeHints.h>
@@ -96,6 +97,56 @@ void updateWindingOrder(Gui::LinkView* linkView, App::LinkBaseExtension* ext)
     ext->getTrueLinkedObject(true, &mat, 0, false);
     linkView->renderDoubleSide(mat.determinant3() < 0.0);
 }
+
+SbMatrix toSbMatrix(const Base::Matrix4D& mat)
+{
+    double dMtrx[16];
+    mat.getGLMatrix(dMtrx);
+    return SbMatrix(
+        dMtrx[0],
+        dMtrx[1],
+        dMtrx[2],
+        dMtrx[3],
+        dMtrx[4],
+        dMtrx[5],
+        dMtrx[6],
+        dMtrx[7],
+        dMtrx[8],
+        dMtrx[9],
+        dMtrx[10],
+        dMtrx[11],
+        dMtrx[12],
+        dMtrx[13],
+        dMtrx[14],
+        dMtrx[15]
+    );
+}
+
+// Suppress the notification of a group node while many of its descendants
+// change, and notify once at the end. Large link arrays would otherwise
+// invalidate the caches up to the scene root once per element.
+class NotifyBlocker
+{
+public:
+    explicit NotifyBlocker(SoNode* node)
+        : node(node)
+        , autonotify(node->enableNotify(FALSE))
+    {}
+    ~NotifyBlocker()
+    {
+        node->enableNotify(autonotify);
+        if (autonotify) {
+            node->touch();
+        }
+    }
+
+    NotifyBlocker(const NotifyBlocker&) = delete;
+    NotifyBlocker& operator=(const NotifyBlocker&) = delete;
+
+private:
+    SoNode* node;
+    SbBool autonotify;
+};
 }  // namespace
 
 using CharRange = boost::iterator_range<const char*>;
@@ -992,7 +1043,7 @@ public:
     LinkView& handle;
     CoinPtr<SoSwitch> pcSwitch;
     CoinPtr<SoFCSelectionRoot> pcRoot;
-    CoinPtr<SoTransform> pcTransform;
+    CoinPtr<SoMatrixTransform> pcTransform;
     int groupIndex = -1;
     bool isGroup = false;
 
@@ -1001,8 +1052,12 @@ public:
     Element(LinkView& handle)
         : handle(handle)
     {
-        pcTransform = new SoTransform;
+        // A plain matrix avoids decomposing the placement when it is set and
+        // composing it again on every traversal
+        pcTransform = new SoMatrixTransform;
         pcRoot = new SoFCSelectionRoot(true);
+        // skip elements outside the view frustum, arrays can have many of them
+        pcRoot->renderCulling = SoSeparator::ON;
         pcSwitch = new SoSwitch;
         pcSwitch->addChild(pcRoot);
         pcSwitch->whichChild = 0;
@@ -1262,26 +1317,7 @@ void LinkView::setLinkViewObject(ViewProviderDocumentObject* vpd, const std::vec
 
 void LinkView::setTransform(SoTransform* pcTransform, const Base::Matrix4D& mat)
 {
-    double dMtrx[16];
-    mat.getGLMatrix(dMtrx);
-    pcTransform->setMatrix(SbMatrix(
-        dMtrx[0],
-        dMtrx[1],
-        dMtrx[2],
-        dMtrx[3],
-        dMtrx[4],
-        dMtrx[5],
-        dMtrx[6],
-        dMtrx[7],
-        dMtrx[8],
-        dMtrx[9],
-        dMtrx[10],
-        dMtrx[11],
-        dMtrx[12],
-        dMtrx[13],
-        dMtrx[14],
-        dMtrx[15]
-    ));
+    pcTransform->setMatrix(toSbMatrix(mat));
 }
 
 void LinkView::setSize(int _size)
@@ -1308,6 +1344,7 @@ void LinkView::setSize(int _size)
         }
         nodeArray.resize(size);
     }
+    NotifyBlocker blocker(pcLinkRoot);
     for (const auto& info : nodeArray) {
         pcLinkRoot->addChild(info->pcSwitch);
     }
@@ -1362,6 +1399,7 @@ void LinkView::setChildren(
     }
 
     resetRoot();
+    NotifyBlocker blocker(pcLinkRoot);
 
     if (childType < 0) {
         nodeArray.clear();
@@ -1435,7 +1473,15 @@ void LinkView::setTransform(int index, const Base::Matrix4D& mat)
     if (index < 0 || index >= (int)nodeArray.size()) {
         LINK_THROW(Base::ValueError, "LinkView: index out of range");
     }
-    setTransform(nodeArray[index]->pcTransform, mat);
+    nodeArray[index]->pcTransform->matrix.setValue(toSbMatrix(mat));
+}
+
+void LinkView::setTransforms(const std::vector<std::pair<int, Base::Matrix4D>>& transforms)
+{
+    NotifyBlocker blocker(pcLinkRoot);
+    for (const auto& [index, mat] : transforms) {
+        setTransform(index, mat);
+    }
 }
 
 void LinkView::setElementVisible(int idx, bool visible)
@@ -1445,6 +1491,17 @@ void LinkView::setElementVisible(int idx, bool visible)
     }
 }
 
+void LinkView::setElementsVisible(const boost::dynamic_bitset<>& vis)
+{
+    NotifyBlocker blocker(pcLinkRoot);
+    for (size_t i = 0; i < nodeArray.size(); ++i) {
+        int which = (vis.size() <= i || vis[i]) ? 0 : SO_SWITCH_NONE;
+        if (nodeArray[i]->pcSwitch->whichChild.getValue() != which) {
+            nodeArray[i]->pcSwitch->whichChild = which;
+        }
+    }
+}
+
 bool LinkView::isElementVisible(int idx) const
 {
     if (idx >= 0 && idx < (int)nodeArray.size()) {
@@ -2362,18 +2419,23 @@ void ViewProviderLink::updateDataPrivate(App::LinkBaseExtension* ext, const App:
             if (propPlacements && linkView->getSize()) {
                 const auto& touched = prop == propScales ? propScales->getTouchList()
                                                          : propPlacements->getTouchList();
+                auto getMatrix = [&](int i) {
+                    Base::Matrix4D mat;
+                    if (propPlacements && propPlacements->getSize() > i) {
+                        mat = (*propPlacements)[i].toMatrix();
+                    }
+                    if (propScales && propScales->getSize() > i && canScale((*propScales)[i])) {
+                        Base::Matrix4D s;
+                        s.scale((*propScales)[i]);
+                        mat *= s;
+                    }
+                    return mat;
+                };
+                std::vector<std::pair<int, Base::Matrix4D>> transforms;
                 if (touched.empty()) {
+                    transforms.reserve(linkView->getSize());
                     for (int i = 0; i < linkView->getSize(); ++i) {
-                        Base::Matrix4D mat;
-                        if (propPlacements && propPlacements->getSize() > i) {
-                            mat = (*propPlacements)[i].toMatrix();
-                        }
-                        if (propScales && propScales->getSize() > i && canScale((*propScales)[i])) {
-                            Base::Matrix4D s;
-                            s.scale((*propScales)[i]);
-                            mat *= s;
-                        }
-                        linkView->setTransform(i, mat);
+                        transforms.emplace_back(i, getMatrix(i));
                     }
                 }
                 else {
@@ -2381,31 +2443,15 @@ void ViewProviderLink::updateDataPrivate(App::LinkBaseExtension* ext, const App:
                         if (i < 0 || i >= linkView->getSize()) {
                             continue;
                         }
-                        Base::Matrix4D mat;
-                        if (propPlacements && propPlacements->getSize() > i) {
-                            mat = (*propPlacements)[i].toMatrix();
-                        }
-                        if (propScales && propScales->getSize() > i && canScale((*propScales)[i])) {
-                            Base::Matrix4D s;
-                            s.scale((*propScales)[i]);
-                            mat *= s;
-                        }
-                        linkView->setTransform(i, mat);
+                        transforms.emplace_back(i, getMatrix(i));
                     }
                 }
+                linkView->setTransforms(transforms);
             }
         }
     }
     else if (prop == ext->getVisibilityListProperty()) {
-        const auto& vis = ext->getVisibilityListValue();
-        for (size_t i = 0; i < (size_t)linkView->getSize(); ++i) {
-            if (vis.size() > i) {
-                linkView->setElementVisible(i, vis[i]);
-            }
-            else {
-                linkView->setElementVisible(i, true);
-            }
-        }
+        linkView->setElementsVisible(ext->getVisibilityListValue());
     }
     else if (prop == ext->_getElementListProperty()) {
         if (ext->_getShowElementValue()) {
@@ -136,6 +136,8 @@ public:
     void setMaterial(int index, const App::Material* material);
     void setDrawStyle(int linePattern, double lineWidth = 0, double pointSize = 0);
     void setTransform(int index, const Base::Matrix4D& mat);
+    /// Set the transformation of many elements with one scene graph notification
+    void setTransforms(const std::vector<std::pair<int, Base::Matrix4D>>& transforms);
     void renderDoubleSide(bool);
     void setSize(int size);
 
@@ -176,6 +178,8 @@ public:
     bool linkGetElementPicked(const SoPickedPoint*, std::string&) const;
 
     void setElementVisible(int index, bool visible);
+    /// Set the visibility of all elements, elements beyond @a vis are visible
+    void setElementsVisible(const boost::dynamic_bitset<>& vis);
     bool isElementVisible(int index) const;
 
     ViewProviderDocumentObject* getOwner() const;
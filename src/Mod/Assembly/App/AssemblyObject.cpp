@@ -153,9 +153,23 @@ int AssemblyObject::solve(bool enableRedo)
     objectPartMap.clear();
     motions.clear();
 
+    fixedConnections.clear();
+    if (bundleFixed) {
+        for (auto* joint : getJoints()) {
+            if (getJointType(joint) != JointType::Fixed) {
+                continue;
+            }
+            App::DocumentObject* part1 = getMovingPartFromRef(joint, "Reference1");
+            App::DocumentObject* part2 = getMovingPartFromRef(joint, "Reference2");
+            fixedConnections[part1].push_back(part2);
+            fixedConnections[part2].push_back(part1);
+        }
+    }
+
     auto groundedObjs = fixGroundedParts();
     if (groundedObjs.empty()) {
         // If no part fixed we can't solve.
+        fixedConnections.clear();
         return -6;
     }
 
@@ -164,6 +178,7 @@ int AssemblyObject::solve(bool enableRedo)
     removeUnconnectedJoints(joints, groundedObjs);
 
     jointParts(joints);
+    fixedConnections.clear();
 
     if (enableRedo) {
         savePlacementsForUndo();
@@ -350,6 +365,9 @@ void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
     bundleFixed = false;
 
     draggedParts.clear();
+    dragJoints = getJoints();
+    dragGroundedParts = getGroundedParts();
+    dragMbdParts = std::make_shared<std::vector<std::shared_ptr<ASMTPart>>>();
     for (auto part : dragParts) {
         // make sure no duplicate
         if (std::ranges::find(draggedParts, part) != draggedParts.end()) {
@@ -383,8 +401,13 @@ void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
 
 void AssemblyObject::doDragStep()
 {
+    if (!dragMbdParts) {
+        return;
+    }
+
     try {
-        std::vector<std::shared_ptr<MbD::ASMTPart>> dragMbdParts;
+        // Reuse the vector handed to the solver, it only allocates on the first step.
+        dragMbdParts->clear();
 
         for (auto& part : draggedParts) {
             if (!part) {
@@ -392,7 +415,7 @@ void AssemblyObject::doDragStep()
             }
 
             auto mbdPart = getMbDPart(part);
-            dragMbdParts.push_back(mbdPart);
+            dragMbdParts->push_back(mbdPart);
 
             // Update the MBD part's position
             Base::Placement plc = getPlacementFromProp(part, "Placement");
@@ -411,16 +434,12 @@ void AssemblyObject::doDragStep()
             mbdPart->updateMbDFromRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
         }
 
-        // Timing mbdAssembly->runDragStep()
-        auto dragPartsVec = std::make_shared<std::vector<std::shared_ptr<ASMTPart>>>(dragMbdParts);
-        mbdAssembly->runDragStep(dragPartsVec);
+        mbdAssembly->runDragStep(dragMbdParts);
 
-        // Timing the validation and placement setting
         if (validateNewPlacements()) {
             setNewPlacements();
 
-            auto joints = getJoints();
-            for (auto* joint : joints) {
+            for (auto* joint : dragJoints) {
                 if (joint->Visibility.getValue()) {
                     // redraw only the moving joint as its quite slow as its python code.
                     redrawJointPlacement(joint);
@@ -453,7 +472,7 @@ Base::Placement AssemblyObject::getMbdPlacement(std::shared_ptr<ASMTPart> mbdPar
 bool AssemblyObject::validateNewPlacements()
 {
     // First we check if a grounded object has moved. It can happen that they flip.
-    auto groundedParts = getGroundedParts();
+    auto groundedParts = dragMbdParts ? dragGroundedParts : getGroundedParts();
     for (auto* obj : groundedParts) {
         auto* propPlacement = obj->getPlacementProperty();
         if (propPlacement) {
@@ -486,6 +505,9 @@ bool AssemblyObject::validateNewPlacements()
 void AssemblyObject::postDrag()
 {
     mbdAssembly->runPostDrag();  // Do this after last drag
+    dragJoints.clear();
+    dragGroundedParts.clear();
+    dragMbdParts.reset();
     purgeTouched();
 }
 
@@ -1885,26 +1907,22 @@ AssemblyObject::MbDPartData AssemblyObject::getMbDData(App::DocumentObject* part
     // Associate other objects connected with fixed joints
     if (bundleFixed) {
         auto addConnectedFixedParts = [&](App::DocumentObject* currentPart, auto& self) -> void {
-            std::vector<App::DocumentObject*> joints = getJointsOfPart(currentPart);
-            for (auto* joint : joints) {
-                JointType jointType = getJointType(joint);
-                if (jointType == JointType::Fixed) {
-                    App::DocumentObject* part1 = getMovingPartFromRef(joint, "Reference1");
-                    App::DocumentObject* part2 = getMovingPartFromRef(joint, "Reference2");
-                    App::DocumentObject* partToAdd = currentPart == part1 ? part2 : part1;
-
-                    if (objectPartMap.find(partToAdd) != objectPartMap.end()) {
-                        // already added
-                        continue;
-                    }
+            auto it = fixedConnections.find(currentPart);
+            if (it == fixedConnections.end()) {
+                return;
+            }
+            for (auto* partToAdd : it->second) {
+                if (objectPartMap.find(partToAdd) != objectPartMap.end()) {
+                    // already added
+                    continue;
+                }
 
-                    Base::Placement plci = getPlacementFromProp(partToAdd, "Placement");
-                    MbDPartData partData = {mbdPart, plc.inverse() * plci};
-                    objectPartMap[partToAdd] = partData;  // Store the association
+                Base::Placement plci = getPlacementFromProp(partToAdd, "Placement");
+                MbDPartData partData = {mbdPart, plc.inverse() * plci};
+                objectPartMap[partToAdd] = partData;  // Store the association
 
-                    // Recursively call for partToAdd
-                    self(partToAdd, self);
-                }
+                // Recursively call for partToAdd
+                self(partToAdd, self);
             }
         };
 
@@ -259,6 +259,14 @@ private:
     std::unordered_map<App::DocumentObject*, MbDPartData> objectPartMap;
     std::vector<std::pair<App::DocumentObject*, double>> objMasses;
     std::vector<App::DocumentObject*> draggedParts;
+    // The joints and grounded parts do not change while dragging, so preDrag() collects them
+    // once instead of querying the document on every drag step.
+    std::vector<App::DocumentObject*> dragJoints;
+    std::unordered_set<App::DocumentObject*> dragGroundedParts;
+    // Handed to the solver on each drag step, set between preDrag() and postDrag().
+    std::shared_ptr<std::vector<std::shared_ptr<MbD::ASMTPart>>> dragMbdParts;
+    // Parts connected to each other by a fixed joint, filled by solve() when bundling.
+    std::unordered_map<App::DocumentObject*, std::vector<App::DocumentObject*>> fixedConnections;
     std::vector<App::DocumentObject*> motions;
 
     std::vector<std::pair<App::DocumentObject*, Base::Placement>> previousPositions;
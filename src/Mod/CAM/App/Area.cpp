@@ -25,6 +25,7 @@
 // From Boost 1.75 on the geometry component requires C++14
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
+#include <exception>
 #include <limits>
 #include <optional>
 
@@ -39,6 +40,7 @@
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -56,6 +58,7 @@
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeAnalysis_FreeBounds.hxx>
 #include <ShapeExtend_WireData.hxx>
@@ -164,7 +167,7 @@ CAreaConfig::~CAreaConfig()
 
 TYPESYSTEM_SOURCE(Path::Area, Base::BaseClass)
 
-bool Area::s_aborting;
+std::atomic<bool> Area::s_aborting;
 
 Area::Area(const AreaParams* params)
     : myParams(s_params)
@@ -1480,6 +1483,37 @@ static void showShapes(const T& shapes, const char* name, const char* fmt = null
     }
 }
 
+/** Call \c func with the index of each section, concurrently if \c parallel is true
+ *
+ * Exceptions are rethrown in the calling thread. The debug shapes of
+ * showShape() are added to the active document, so everything is done in the
+ * calling thread when tracing.
+ */
+template<class Func>
+static void forEachSection(std::size_t count, bool parallel, const Func& func)
+{
+    if (!parallel || count < 2 || FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+        for (std::size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+    std::vector<std::exception_ptr> errors(count);
+    OSD_Parallel::For(0, static_cast<int>(count), [&](int i) {
+        try {
+            func(static_cast<std::size_t>(i));
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 template<class Func>
 static int foreachSubshape(
     const TopoDS_Shape& shape,
@@ -1865,15 +1899,12 @@ std::vector<shared_ptr<Area>> Area::makeSections(
         throw Base::ValueError("no sections");
     }
 
-    std::vector<shared_ptr<Area>> sections;
-    sections.reserve(heights.size());
-
     std::list<Shape> projectedShapes;
     if (project) {
         projectedShapes = getProjectedShapes(trsf, false);
         if (projectedShapes.empty()) {
             AREA_ERR("empty projection");
-            return sections;
+            return {};
         }
     }
 
@@ -1881,7 +1912,25 @@ std::vector<shared_ptr<Area>> Area::makeSections(
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
+    // ShapeFix_ShapeTolerance changes the solids in place, and they are shared by
+    // all sections. So fix them once here instead of in each (concurrent) section.
+    std::vector<std::vector<TopoDS_Shape>> solids;
+    if (!project) {
+        solids.reserve(myShapes.size());
+        for (const auto& s : myShapes) {
+            auto& shapeSolids = solids.emplace_back();
+            for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More(); xp.Next()) {
+                TopoDS_Shape shape(xp.Current());
+                ShapeFix_ShapeTolerance sTol;
+                sTol.SetTolerance(shape, Precision::Confusion());
+                shapeSolids.push_back(shape);
+            }
+        }
+    }
+
+    // The sections are converted through libarea right away, so that this is
+    // done concurrently as well
+    auto makeSection = [&](size_t i) -> shared_ptr<Area> {
         double z = heights[i];
         bool retried = !can_retry;
         while (true) {
@@ -1902,20 +1951,21 @@ std::vector<shared_ptr<Area>> Area::makeSections(
                     TopLoc_Location wloc(t);
                     area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
                 }
-                sections.push_back(area);
-                break;
+                area->build();
+                return area;
             }
 
-            for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
+            std::size_t index = 0;
+            for (auto it = myShapes.begin(); it != myShapes.end(); ++it, ++index) {
                 const auto& s = *it;
                 BRep_Builder builder;
                 TopoDS_Compound comp;
                 builder.MakeCompound(comp);
 
-                for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More(); xp.Next()) {
-                    TopoDS_Shape shape(xp.Current());
-                    ShapeFix_ShapeTolerance sTol;
-                    sTol.SetTolerance(shape, Precision::Confusion());
+                for (const TopoDS_Shape& solid : solids[index]) {
+                    // The boolean of the slicing may update the tolerances of its
+                    // arguments, so a concurrent section works on its own copy
+                    TopoDS_Shape shape = parallel ? BRepBuilderAPI_Copy(solid).Shape() : solid;
 
                     showShape(shape, nullptr, "section_%zu_shape", i);
                     std::list<TopoDS_Wire> wires;
@@ -1989,13 +2039,13 @@ std::vector<shared_ptr<Area>> Area::makeSections(
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
+                area->build();
                 showShape(area->getShape(), nullptr, "section_%zu_final", i);
-                break;
+                return area;
             }
             if (retried) {
                 AREA_WARN("Discard empty section");
-                break;
+                return shared_ptr<Area>();
             }
             else {
                 AREA_TRACE("retry section " << z << "->" << z + tolerance);
@@ -2003,6 +2053,20 @@ std::vector<shared_ptr<Area>> Area::makeSections(
                 retried = true;
             }
         }
+    };
+
+    // Each section is computed into its own slot, and the slots are merged in
+    // the order of the heights afterwards, so the result does not depend on
+    // the scheduling of the threads.
+    std::vector<shared_ptr<Area>> results(heights.size());
+    forEachSection(heights.size(), parallel, [&](size_t i) { results[i] = makeSection(i); });
+
+    std::vector<shared_ptr<Area>> sections;
+    sections.reserve(heights.size());
+    for (auto& area : results) {
+        if (area) {
+            sections.push_back(std::move(area));
+        }
     }
     return sections;
 }
@@ -2214,11 +2278,14 @@ TopoDS_Shape Area::toShape(CArea& area, short fill, int reorient)
             if (_index >= (int)mySections.size()) \
                 return TopoDS_Shape(); \
             if (_index < 0) { \
+                std::vector<TopoDS_Shape> shapes(mySections.size()); \
+                forEachSection(mySections.size(), myParams.SectionParallel, [&](std::size_t i) { \
+                    shapes[i] = mySections[i]->_op(_index, ##__VA_ARGS__); \
+                }); \
                 BRep_Builder builder; \
                 TopoDS_Compound compound; \
                 builder.MakeCompound(compound); \
-                for (shared_ptr<Area> area : mySections) { \
-                    const TopoDS_Shape& s = area->_op(_index, ##__VA_ARGS__); \
+                for (const TopoDS_Shape& s : shapes) { \
                     if (s.IsNull()) \
                         continue; \
                     builder.Add(compound, s); \
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
@@ -86,6 +87,8 @@ struct PathExport AreaStaticParams: AreaParams
  *
  * It is kind of troublesome with the fact that libarea uses static variables to
  * config its algorithm. CAreaConfig makes it easy to safely customize libarea.
+ * The variables are thread local, so the configuration only applies to the
+ * calling thread, and areas can be built concurrently in different threads.
  */
 struct PathExport CAreaConfig
 {
@@ -141,7 +144,7 @@ protected:
     bool myProjecting;
     mutable int mySkippedShapes;
 
-    static bool s_aborting;
+    static std::atomic<bool> s_aborting;
     static AreaStaticParams s_params;
 
     /** Called internally to combine children shapes for further processing */
@@ -258,8 +261,9 @@ public:
      * \arg \c plane: the section plane if the section mode is
      * SectionModeWorkplane, otherwise ignored
      *
-     * See #AREA_PARAMS_EXTRA for description of the arguments. Currently, there
-     * is only one argument, namely \c mode for section mode.
+     * See #AREA_PARAMS_SECTION_EXTRA for description of the arguments. If
+     * \c parallel is true, the sections are computed concurrently, and are
+     * returned in the same order as when computed one after the other.
      */
     std::vector<std::shared_ptr<Area>> makeSections(
         PARAM_ARGS_DEF(PARAM_FARG, AREA_PARAMS_SECTION_EXTRA),
@@ -225,6 +225,12 @@
          false, \
          "The section is produced by normal projecting the outline\n" \
          "of all added shapes to the section plane, instead of slicing.") \
+    )( \
+        (bool, \
+         parallel, \
+         SectionParallel, \
+         true, \
+         "Compute the sections concurrently.") \
     )
 
 /** Section parameters */
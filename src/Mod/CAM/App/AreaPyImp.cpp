@@ -462,7 +462,7 @@ PyObject* AreaPy::makePocket(PyObject* args, PyObject* keywds)
 
 PyObject* AreaPy::makeSections(PyObject* args, PyObject* keywds)
 {
-    static const std::array<const char*, 5> kwlist {
+    static const std::array<const char*, 6> kwlist {
         PARAM_FIELD_STRINGS(ARG, AREA_PARAMS_SECTION_EXTRA),
         "heights",
         "plane",
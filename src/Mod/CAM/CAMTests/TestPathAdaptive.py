@@ -213,6 +213,7 @@ class TestPathAdaptive(PathTestBase):
         a2d.forceInsideOut = kwargs.get("forceInsideOut", False)
         a2d.finishingProfile = kwargs.get("finishingProfile", True)
         a2d.keepToolDownDistRatio = kwargs.get("keepToolDownDistRatio", 3.0)
+        a2d.parallelRegions = kwargs.get("parallelRegions", True)
         a2d.opType = opType
 
         # Create progress callback for visualization
@@ -230,6 +231,7 @@ class TestPathAdaptive(PathTestBase):
 
         # Return total cleared area and the configured instance
         total_cleared = sum(r.ClearedArea for r in results)
+        self.lastResults = results
         return total_cleared, a2d
 
     def _calculateCornerUnclearableArea(self, tool_diameter):
@@ -339,6 +341,51 @@ class TestPathAdaptive(PathTestBase):
             msg=f"Total cleared area {total_cleared} should be within {delta} of {expected_area}",
         )
 
+    def testClearInsideSeveralRegions(self):
+        """testClearInsideSeveralRegions() Test C++ Adaptive2d on separate regions, processed concurrently or not."""
+        # Three separate pockets of different size in one stock
+        stockPath2d = [[[0.0, 0.0], [150.0, 0.0], [150.0, 60.0], [0.0, 60.0]]]
+        pockets = [(5.0, 5.0, 40.0, 40.0), (55.0, 5.0, 30.0, 50.0), (95.0, 10.0, 50.0, 25.0)]
+        path2d = [
+            [[x, y], [x + width, y], [x + width, y + height], [x, y + height]]
+            for x, y, width, height in pockets
+        ]
+
+        def outputOf(results):
+            return [
+                (
+                    tuple(r.HelixCenterPoint),
+                    tuple(r.StartPoint),
+                    r.ReturnMotionType,
+                    [(motion, [tuple(pt) for pt in pts]) for motion, pts in r.AdaptivePaths],
+                    r.ClearedArea,
+                )
+                for r in results
+            ]
+
+        total_serial, a2d = self._executeAdaptive(
+            area.AdaptiveOperationType.ClearingInside, stockPath2d, path2d, parallelRegions=False
+        )
+        serial = outputOf(self.lastResults)
+        total_parallel, _ = self._executeAdaptive(
+            area.AdaptiveOperationType.ClearingInside, stockPath2d, path2d, parallelRegions=True
+        )
+        parallel = outputOf(self.lastResults)
+
+        # One result per region, the same paths in the same order either way
+        self.assertEqual(len(serial), len(pockets))
+        self.assertEqual(parallel, serial)
+        self.assertEqual(total_parallel, total_serial)
+
+        # Each pocket is cleared up to its corners, the same bound the untiled
+        # cleared area met in testClearInside(). The regions may come in any
+        # order, the pockets differ in size.
+        corner_unclearable_area = self._calculateCornerUnclearableArea(a2d.toolDiameter)
+        expected_areas = sorted(w * h - 4 * corner_unclearable_area for _, _, w, h in pockets)
+        cleared_areas = sorted(result[4] for result in serial)
+        for cleared, expected in zip(cleared_areas, expected_areas):
+            self.assertAlmostEqual(cleared, expected, delta=corner_unclearable_area / 2.0)
+
     def testClearOutside(self):
         """testClearOutside() Test C++ Adaptive2d clearing outside a simple rectangle."""
         # Create geometry
@@ -0,0 +1,82 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import Part
+import Path
+
+from FreeCAD import Vector
+from CAMTests.PathTestUtils import PathTestBase
+
+
+class TestPathArea(PathTestBase):
+    """Test Path.Area sections."""
+
+    heights = [0.5, 2.5, 4.5, 6.5, 8.5, 9.5]
+
+    def makeArea(self):
+        """Return an area of several solids that change their outline along z."""
+        solids = [
+            Part.makeBox(10, 10, 10, Vector(0, 0, 0)),
+            Part.makeCylinder(5, 10, Vector(20, 5, 0)),
+            Part.makeSphere(5, Vector(35, 5, 5)),
+            Part.makeCone(5, 1, 10, Vector(50, 5, 0)),
+        ]
+        area = Path.Area()
+        area.setPlane(Part.makeCircle(10))
+        area.add(Part.makeCompound(solids))
+        return area
+
+    def assertSectionsMatch(self, sections, expected):
+        self.assertEqual(len(sections), len(expected))
+        for section, other in zip(sections, expected):
+            shape = section.getShape()
+            otherShape = other.getShape()
+            self.assertEqual(len(shape.Edges), len(otherShape.Edges))
+            self.assertRoughly(shape.Length, otherShape.Length, 1e-6)
+            self.assertCoincide(shape.BoundBox.getPoint(0), otherShape.BoundBox.getPoint(0))
+            self.assertCoincide(shape.BoundBox.getPoint(6), otherShape.BoundBox.getPoint(6))
+
+    def test00(self):
+        """Verify that concurrent sections of several solids match the serial ones."""
+        serial = self.makeArea().makeSections(mode=0, heights=self.heights, parallel=False)
+        for _ in range(3):
+            parallel = self.makeArea().makeSections(mode=0, heights=self.heights, parallel=True)
+            self.assertSectionsMatch(parallel, serial)
+
+    def test01(self):
+        """Verify that repeated concurrent sections of the same area match."""
+        area = self.makeArea()
+        first = area.makeSections(mode=0, heights=self.heights, parallel=True)
+        second = area.makeSections(mode=0, heights=self.heights, parallel=True)
+        serial = area.makeSections(mode=0, heights=self.heights, parallel=False)
+        self.assertSectionsMatch(second, first)
+        self.assertSectionsMatch(serial, first)
+
+    def test02(self):
+        """Verify that each section holds the outline of every solid."""
+        sections = self.makeArea().makeSections(mode=0, heights=[2.5], parallel=True)
+        self.assertEqual(len(sections), 1)
+        bb = sections[0].getShape().BoundBox
+        self.assertRoughly(bb.XMin, 0, 1e-4)
+        self.assertRoughly(bb.ZMin, 2.5, 1e-4)
+        self.assertRoughly(bb.ZMax, 2.5, 1e-4)
+        self.assertTrue(bb.XMax > 50)
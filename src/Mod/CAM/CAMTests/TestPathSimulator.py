@@ -0,0 +1,153 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import math
+
+import FreeCAD
+import Part
+import Path
+import PathSimulator
+
+from FreeCAD import Vector
+from CAMTests.PathTestUtils import PathTestBase
+
+
+class TestPathSimulator(PathTestBase):
+    """Test the volumetric stock simulation of PathSimulator.PathSim."""
+
+    # 200 x 200 pixels, which are split into several stock tiles
+    resolution = 0.1
+
+    def makeSim(self, toolLength=20):
+        """Return a simulation of a 20 x 20 x 10 stock with a 2 mm flat end mill."""
+        sim = PathSimulator.PathSim()
+        sim.BeginSimulation(Part.makeBox(20, 20, 10), self.resolution)
+        sim.SetToolShape(Part.makeCylinder(1, toolLength), 0.05)
+        return sim
+
+    def start(self):
+        return FreeCAD.Placement(Vector(2, 10, 15), FreeCAD.Rotation())
+
+    def slotCommands(self):
+        """Plunge 2 mm, cut a slot along x across several tiles, pocket a circle and retract."""
+        return [
+            Path.Command("G1", {"Z": 8}),
+            Path.Command("G1", {"X": 18}),
+            Path.Command("G0", {"Z": 15}),
+            Path.Command("G0", {"X": 10, "Y": 4}),
+            Path.Command("G1", {"Z": 9}),
+            Path.Command("G2", {"X": 10, "Y": 4, "I": 0, "J": 2}),
+            Path.Command("G0", {"Z": 15}),
+        ]
+
+    def assertMeshesMatch(self, meshes, expected):
+        for mesh, other in zip(meshes, expected):
+            self.assertEqual(mesh.CountPoints, other.CountPoints)
+            self.assertEqual(mesh.CountFacets, other.CountFacets)
+            self.assertRoughly(mesh.Area, other.Area, 1e-6)
+            self.assertCoincide(mesh.BoundBox.getPoint(0), other.BoundBox.getPoint(0))
+            self.assertCoincide(mesh.BoundBox.getPoint(6), other.BoundBox.getPoint(6))
+
+    def assertStatisticsMatch(self, stats, expected):
+        self.assertEqual(sorted(stats.keys()), sorted(expected.keys()))
+        for key, value in expected.items():
+            if isinstance(value, float):
+                self.assertRoughly(stats[key], value, 1e-6)
+            else:
+                self.assertEqual(stats[key], value)
+
+    def test00(self):
+        """Verify that a batch of commands gives the same result as one command at a time."""
+        single = self.makeSim()
+        pos = self.start()
+        for cmd in self.slotCommands():
+            pos = single.ApplyCommand(pos, cmd)
+
+        batch = self.makeSim()
+        end = batch.ApplyCommands(self.start(), self.slotCommands())
+
+        self.assertCoincide(end.Base, pos.Base)
+        self.assertMeshesMatch(batch.GetResultMesh(), single.GetResultMesh())
+        self.assertStatisticsMatch(batch.GetStatistics(), single.GetStatistics())
+
+    def test01(self):
+        """Verify that a Path gives the same result as the list of its commands."""
+        commands = self.slotCommands()
+        fromList = self.makeSim()
+        fromList.ApplyCommands(self.start(), commands)
+        fromPath = self.makeSim()
+        fromPath.ApplyCommands(self.start(), Path.Path(commands))
+
+        self.assertMeshesMatch(fromPath.GetResultMesh(), fromList.GetResultMesh())
+        self.assertStatisticsMatch(fromPath.GetStatistics(), fromList.GetStatistics())
+
+    def test02(self):
+        """Verify the statistics of a slot and a circular pocket."""
+        sim = self.makeSim()
+        sim.ApplyCommands(self.start(), self.slotCommands())
+        stats = sim.GetStatistics()
+
+        # the slot is 2 mm deep, the circle of radius 2 is cut 1 mm deep with a 2 mm tool
+        slot = 2 * (2 * 16 + math.pi)
+        circle = 1 * (math.pi * 3 * 3 - math.pi * 1 * 1)
+        self.assertEqual(stats["Moves"], 7)
+        self.assertEqual(stats["CuttingMoves"], 4)
+        self.assertRoughly(stats["RemovedVolume"], slot + circle, 0.05 * (slot + circle))
+        self.assertEqual(stats["RapidCollisions"], 0)
+        self.assertEqual(stats["HolderCollisions"], 0)
+        self.assertEqual(stats["CollisionMoves"], [])
+        self.assertEqual(stats["Gouges"], 0)
+        self.assertEqual(stats["GougeVolume"], 0)
+        self.assertEqual(stats["GougeMoves"], [])
+
+    def test03(self):
+        """Verify that rapid moves into the stock and holder hits are reported."""
+        sim = self.makeSim(toolLength=1)
+        sim.ApplyCommands(
+            self.start(),
+            [
+                Path.Command("G0", {"Z": 9.5}),
+                Path.Command("G1", {"Z": 8}),
+                Path.Command("G0", {"Z": 15}),
+            ],
+        )
+        stats = sim.GetStatistics()
+
+        self.assertEqual(stats["Moves"], 3)
+        self.assertEqual(stats["CuttingMoves"], 2)
+        self.assertEqual(stats["RapidCollisions"], 1)
+        # the second move reaches 2 mm into the stock with a tool of 1 mm length
+        self.assertEqual(stats["HolderCollisions"], 1)
+        self.assertEqual(stats["CollisionMoves"], [0, 1])
+
+    def test04(self):
+        """Verify that cuts below the surface of the part are reported as gouges."""
+        sim = self.makeSim()
+        sim.SetPartShape(Part.makeBox(20, 20, 9), 0.01)
+        sim.ApplyCommands(self.start(), self.slotCommands()[:3])
+        stats = sim.GetStatistics()
+
+        # the slot reaches 1 mm below the top of the part
+        gouge = 1 * (2 * 16 + math.pi)
+        self.assertEqual(stats["Gouges"], 2)
+        self.assertEqual(stats["GougeMoves"], [0, 1])
+        self.assertRoughly(stats["GougeVolume"], gouge, 0.05 * gouge)
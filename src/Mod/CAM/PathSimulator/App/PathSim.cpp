@@ -23,12 +23,38 @@
  ***************************************************************************/
 
 
+#include <Base/Exception.h>
+
 #include "PathSim.h"
 
 
 using namespace Base;
 using namespace PathSimulator;
 
+namespace
+{
+
+// set up the tool motion of a command, returns false if the command does not cut
+bool MakeMove(Point3D& fromPos, Point3D& toPos, Command& cmd, cSimMove& move)
+{
+    move.p1 = fromPos;
+    move.p2 = toPos;
+    if (cmd.Name == "G0" || cmd.Name == "G1") {
+        move.type = cSimMove::Linear;
+        move.rapid = cmd.Name == "G0";
+        return true;
+    }
+    if (cmd.Name == "G2" || cmd.Name == "G3") {
+        Vector3d vcent = cmd.getCenter();
+        move.cent = Point3D(vcent);
+        move.type = cmd.Name == "G3" ? cSimMove::ArcCCW : cSimMove::ArcCW;
+        return true;
+    }
+    return false;
+}
+
+}  // namespace
+
 TYPESYSTEM_SOURCE(PathSimulator::PathSim, Base::BaseClass);
 
 PathSim::PathSim()
@@ -56,25 +82,34 @@ void PathSim::SetToolShape(const TopoDS_Shape& toolShape, float resolution)
     m_tool = std::make_unique<cSimTool>(toolShape, resolution);
 }
 
+void PathSim::SetPartShape(const Part::TopoShape& part, float tolerance)
+{
+    if (!m_stock) {
+        throw Base::RuntimeError("Path Simulation: simulation was not started");
+    }
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::TopoShape::Facet> facets;
+    part.getFaces(points, facets, m_stock->GetResolution() / 2);
+
+    std::vector<Triangle3D> triangles;
+    triangles.reserve(facets.size());
+    for (const auto& facet : facets) {
+        Point3D p1(points[facet.I1]);
+        Point3D p2(points[facet.I2]);
+        Point3D p3(points[facet.I3]);
+        triangles.emplace_back(p1, p2, p3);
+    }
+    m_stock->SetPart(triangles, tolerance);
+}
+
 Base::Placement* PathSim::ApplyCommand(Base::Placement* pos, Command* cmd)
 {
     Point3D fromPos(*pos);
     Point3D toPos(*pos);
     toPos.UpdateCmd(*cmd);
-    if (m_tool) {
-        if (cmd->Name == "G0" || cmd->Name == "G1") {
-            m_stock->ApplyLinearTool(fromPos, toPos, *m_tool);
-        }
-        else if (cmd->Name == "G2") {
-            Vector3d vcent = cmd->getCenter();
-            Point3D cent(vcent);
-            m_stock->ApplyCircularTool(fromPos, toPos, cent, *m_tool, false);
-        }
-        else if (cmd->Name == "G3") {
-            Vector3d vcent = cmd->getCenter();
-            Point3D cent(vcent);
-            m_stock->ApplyCircularTool(fromPos, toPos, cent, *m_tool, true);
-        }
+    cSimMove move;
+    if (m_tool && MakeMove(fromPos, toPos, *cmd, move)) {
+        m_stock->ApplyMoves({move}, *m_tool);
     }
 
     Base::Placement* plc = new Base::Placement();
@@ -82,3 +117,27 @@ Base::Placement* PathSim::ApplyCommand(Base::Placement* pos, Command* cmd)
     plc->setPosition(vec);
     return plc;
 }
+
+Base::Placement* PathSim::ApplyCommands(Base::Placement* pos, const std::vector<Command*>& cmds)
+{
+    Point3D curPos(*pos);
+    std::vector<cSimMove> moves;
+    moves.reserve(cmds.size());
+    for (Command* cmd : cmds) {
+        Point3D toPos = curPos;
+        toPos.UpdateCmd(*cmd);
+        cSimMove move;
+        if (MakeMove(curPos, toPos, *cmd, move)) {
+            moves.push_back(move);
+        }
+        curPos = toPos;
+    }
+    if (m_tool) {
+        m_stock->ApplyMoves(moves, *m_tool);
+    }
+
+    Base::Placement* plc = new Base::Placement();
+    Vector3d vec(curPos.x, curPos.y, curPos.z);
+    plc->setPosition(vec);
+    return plc;
+}
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <TopoDS_Shape.hxx>
 
 #include <Mod/CAM/App/Command.h>
@@ -51,7 +52,11 @@ public:
 
     void BeginSimulation(Part::TopoShape* stock, float resolution);
     void SetToolShape(const TopoDS_Shape& toolShape, float resolution);
+    /// Set the finished part, material removed below its surface is reported as gouge
+    void SetPartShape(const Part::TopoShape& part, float tolerance);
     Base::Placement* ApplyCommand(Base::Placement* pos, Command* cmd);
+    /// Apply a list of commands at once, the stock tiles are processed concurrently
+    Base::Placement* ApplyCommands(Base::Placement* pos, const std::vector<Command*>& cmds);
 
 public:
     std::unique_ptr<cStock> m_stock;
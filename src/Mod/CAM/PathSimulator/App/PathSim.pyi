@@ -2,7 +2,7 @@
 
 from __future__ import annotations
 
-from typing import Any, Final
+from typing import Any, Final, Union
 
 from Base.BaseClass import BaseClass
 from Base.Metadata import export
@@ -10,6 +10,7 @@ from Base.Placement import Placement
 from Part.App.TopoShape import TopoShape
 from Mesh.App.Mesh import Mesh
 from CAM.App.Command import Command
+from CAM.App.Path import Path
 
 @export(
     FatherInclude="Base/BaseClassPy.h",
@@ -48,10 +49,35 @@ class PathSim(BaseClass):
         """
         ...
 
+    def SetPartShape(self, part: TopoShape, tolerance: float = 0.01) -> None:
+        """
+        Set the finished part, material removed deeper than tolerance below its
+        surface is reported as gouge. Call after BeginSimulation.
+        """
+        ...
+
     def ApplyCommand(self, placement: Placement, command: Command) -> Placement:
         """
         Apply a single path command on the stock starting from placement.
         """
         ...
+
+    def ApplyCommands(
+        self, placement: Placement, commands: Union[Path, list[Command]]
+    ) -> Placement:
+        """
+        Apply a path or a list of commands on the stock starting from placement.
+        The stock tiles are processed concurrently. Returns the end placement.
+        """
+        ...
+
+    def GetStatistics(self) -> dict[str, Any]:
+        """
+        Return the statistics of all moves applied since BeginSimulation:
+        Moves, CuttingMoves, RemovedVolume, RapidCollisions, HolderCollisions,
+        Gouges, GougeVolume, and the move indices in CollisionMoves and GougeMoves.
+        Only G0 to G3 commands count as moves.
+        """
+        ...
     Tool: Final[Any]
     """Return current simulation tool."""
@@ -28,6 +28,7 @@
 
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/CAM/App/CommandPy.h>
+#include <Mod/CAM/App/PathPy.h>
 #include <Mod/Part/App/TopoShapePy.h>
 
 #include "PathSim.h"
@@ -95,6 +96,29 @@ PyObject* PathSimPy::SetToolShape(PyObject* args)
     return Py_None;
 }
 
+PyObject* PathSimPy::SetPartShape(PyObject* args, PyObject* kwds)
+{
+    static const std::array<const char*, 3> kwlist {"part", "tolerance", nullptr};
+    PyObject* pObjPart;
+    float tolerance = 0.01F;
+    if (!Base::Wrapped_ParseTupleAndKeywords(
+            args,
+            kwds,
+            "O!|f",
+            kwlist,
+            &(Part::TopoShapePy::Type),
+            &pObjPart,
+            &tolerance
+        )) {
+        return nullptr;
+    }
+    PathSim* sim = getPathSimPtr();
+    const Part::TopoShape* part = static_cast<Part::TopoShapePy*>(pObjPart)->getTopoShapePtr();
+    sim->SetPartShape(*part, tolerance);
+    Py_IncRef(Py_None);
+    return Py_None;
+}
+
 PyObject* PathSimPy::GetResultMesh(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -145,6 +169,79 @@ PyObject* PathSimPy::ApplyCommand(PyObject* args, PyObject* kwds)
     return newposPy;
 }
 
+PyObject* PathSimPy::ApplyCommands(PyObject* args, PyObject* kwds)
+{
+    static const std::array<const char*, 3> kwlist {"position", "commands", nullptr};
+    PyObject* pObjPlace;
+    PyObject* pObjCmds;
+    if (!Base::Wrapped_ParseTupleAndKeywords(
+            args,
+            kwds,
+            "O!O",
+            kwlist,
+            &(Base::PlacementPy::Type),
+            &pObjPlace,
+            &pObjCmds
+        )) {
+        return nullptr;
+    }
+    std::vector<Path::Command*> cmds;
+    if (PyObject_TypeCheck(pObjCmds, &(Path::PathPy::Type))) {
+        cmds = static_cast<Path::PathPy*>(pObjCmds)->getToolpathPtr()->getCommands();
+    }
+    else if (PySequence_Check(pObjCmds)) {
+        Py::Sequence list(pObjCmds);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            if (!PyObject_TypeCheck((*it).ptr(), &(Path::CommandPy::Type))) {
+                PyErr_SetString(PyExc_TypeError, "The list must contain only Path Commands");
+                return nullptr;
+            }
+            cmds.push_back(static_cast<Path::CommandPy*>((*it).ptr())->getCommandPtr());
+        }
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError, "Expected a Path or a list of Path Commands");
+        return nullptr;
+    }
+    PathSim* sim = getPathSimPtr();
+    Base::Placement* pos = static_cast<Base::PlacementPy*>(pObjPlace)->getPlacementPtr();
+    Base::Placement* newpos = sim->ApplyCommands(pos, cmds);
+    return new Base::PlacementPy(newpos);
+}
+
+PyObject* PathSimPy::GetStatistics(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    cStock* stock = getPathSimPtr()->m_stock.get();
+    if (!stock) {
+        PyErr_SetString(PyExc_RuntimeError, "Simulation has no stock object");
+        return nullptr;
+    }
+
+    const cSimStats& stats = stock->GetStats();
+    Py::List collisionMoves;
+    for (int index : stats.collisionMoves) {
+        collisionMoves.append(Py::Long(index));
+    }
+    Py::List gougeMoves;
+    for (int index : stats.gougeMoves) {
+        gougeMoves.append(Py::Long(index));
+    }
+    Py::Dict dict;
+    dict.setItem("Moves", Py::Long(stats.moves));
+    dict.setItem("CuttingMoves", Py::Long(stats.cuttingMoves));
+    dict.setItem("RemovedVolume", Py::Float(stats.removedVolume));
+    dict.setItem("RapidCollisions", Py::Long(stats.rapidCollisions));
+    dict.setItem("HolderCollisions", Py::Long(stats.holderCollisions));
+    dict.setItem("CollisionMoves", collisionMoves);
+    dict.setItem("Gouges", Py::Long(stats.gouges));
+    dict.setItem("GougeVolume", Py::Float(stats.gougeVolume));
+    dict.setItem("GougeMoves", gougeMoves);
+    return Py::new_reference_to(dict);
+}
+
 Py::Object PathSimPy::getTool() const
 {
     // return Py::Object();
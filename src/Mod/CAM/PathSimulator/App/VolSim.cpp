@@ -23,11 +23,13 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <cfloat>
 
 
 #include <BRepBndLib.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
+#include <OSD_Parallel.hxx>
 #include <gp_Pnt.hxx>
 
 #include "VolSim.h"
@@ -37,6 +39,63 @@ using std::numbers::pi;
 //************************************************************************************************************
 // stock
 //************************************************************************************************************
+namespace
+{
+
+// arc geometry in pixel coordinates
+struct ArcGeometry
+{
+    float cx, cy;
+    float radius;
+    float startAngle;
+    float sweep;  // absolute sweep angle
+    float dir;    // 1 for counter clockwise, -1 for clockwise
+};
+
+ArcGeometry MakeArc(const Point3D& p1, const Point3D& p2, const Point3D& cent, bool isCCW)
+{
+    ArcGeometry arc;
+    arc.cx = p1.x + cent.x;
+    arc.cy = p1.y + cent.y;
+    arc.radius = sqrtf(cent.x * cent.x + cent.y * cent.y);
+    arc.startAngle = atan2f(-cent.y, -cent.x);
+    arc.dir = isCCW ? 1.0f : -1.0f;
+    float dx = p2.x - p1.x;
+    float dy = p2.y - p1.y;
+    if (dx * dx + dy * dy < SIM_EPSILON) {
+        // start and end points coincide, this is a full circle
+        arc.sweep = 2 * pi;
+        return arc;
+    }
+    float ang = (atan2f(p2.y - arc.cy, p2.x - arc.cx) - arc.startAngle) * arc.dir;
+    arc.sweep = ang - 2 * pi * floorf(ang / (2 * pi));
+    return arc;
+}
+
+// position of a direction angle along the arc, measured from the arc start (0..2pi)
+inline float ArcPosition(const ArcGeometry& arc, float angle)
+{
+    float ang = (angle - arc.startAngle) * arc.dir;
+    return ang - 2 * pi * floorf(ang / (2 * pi));
+}
+
+// range of v that satisfies lo <= a * v + b <= hi, returns false if there is none
+inline bool SolveRange(float a, float b, float lo, float hi, float& vmin, float& vmax)
+{
+    if (fabsf(a) < SIM_EPSILON) {
+        vmin = -FLT_MAX;
+        vmax = FLT_MAX;
+        return b >= lo && b <= hi;
+    }
+    float v1 = (lo - b) / a;
+    float v2 = (hi - b) / a;
+    vmin = std::min(v1, v2);
+    vmax = std::max(v1, v2);
+    return true;
+}
+
+}  // namespace
+
 cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float res)
     : m_px(px)
     , m_py(py)
@@ -57,13 +116,33 @@ cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float
             m_attr[x][y] = 0;
         }
     }
+
+    m_tx = (m_x + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+    m_ty = (m_y + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+    m_tiles.resize(m_tx * m_ty);
+    for (int ty = 0; ty < m_ty; ty++) {
+        for (int tx = 0; tx < m_tx; tx++) {
+            cStockTile& tile = m_tiles[ty * m_tx + tx];
+            tile.x0 = tx * SIM_TILE_SIZE;
+            tile.y0 = ty * SIM_TILE_SIZE;
+            tile.x1 = std::min(m_x, tile.x0 + SIM_TILE_SIZE);
+            tile.y1 = std::min(m_y, tile.y0 + SIM_TILE_SIZE);
+        }
+    }
 }
 
 cStock::~cStock()
 {}
 
 
-float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz)
+float cStock::FindRectTop(
+    cStockTile& tile,
+    int& xp,
+    int& yp,
+    int& x_size,
+    int& y_size,
+    bool scanHoriz
+)
 {
     float z = m_stock[xp][yp];
     bool xr_ok = true;
@@ -76,7 +155,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep right x direction
         if (xr_ok) {
             int tx = xp + x_size;
-            if (tx >= m_x) {
+            if (tx >= tile.x1) {
                 xr_ok = false;
             }
             else {
@@ -95,7 +174,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep left x direction
         if (xl_ok) {
             int tx = xp - 1;
-            if (tx < 0) {
+            if (tx < tile.x0) {
                 xl_ok = false;
             }
             else {
@@ -115,7 +194,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep up y direction
         if (yu_ok) {
             int ty = yp + y_size;
-            if (ty >= m_y) {
+            if (ty >= tile.y1) {
                 yu_ok = false;
             }
             else {
@@ -134,7 +213,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep down y direction
         if (yd_ok) {
             int ty = yp - 1;
-            if (ty < 0) {
+            if (ty < tile.y0) {
                 yd_ok = false;
             }
             else {
@@ -154,21 +233,21 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
     return z;
 }
 
-int cStock::TesselTop(int xp, int yp)
+int cStock::TesselTop(cStockTile& tile, int xp, int yp)
 {
     int x_size, y_size;
-    float z = FindRectTop(xp, yp, x_size, y_size, true);
+    float z = FindRectTop(tile, xp, yp, x_size, y_size, true);
     bool farRect = false;
     while (y_size / x_size > 5) {
         farRect = true;
         yp += x_size * 5;
-        z = FindRectTop(xp, yp, x_size, y_size, true);
+        z = FindRectTop(tile, xp, yp, x_size, y_size, true);
     }
 
     while (x_size / y_size > 5) {
         farRect = true;
         xp += y_size * 5;
-        z = FindRectTop(xp, yp, x_size, y_size, false);
+        z = FindRectTop(tile, xp, yp, x_size, y_size, false);
     }
 
     // mark all points inside
@@ -185,10 +264,10 @@ int cStock::TesselTop(int xp, int yp)
         Point3D ptl(xp, yp + y_size, z);
         Point3D ptr(xp + x_size, yp + y_size, z);
         if (fabs(m_pz + m_lz - z) < SIM_EPSILON) {
-            AddQuad(pbl, pbr, ptr, ptl, facetsOuter);
+            AddQuad(pbl, pbr, ptr, ptl, tile.facetsOuter);
         }
         else {
-            AddQuad(pbl, pbr, ptr, ptl, facetsInner);
+            AddQuad(pbl, pbr, ptr, ptl, tile.facetsInner);
         }
     }
 
@@ -200,7 +279,14 @@ int cStock::TesselTop(int xp, int yp)
 }
 
 
-void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz)
+void cStock::FindRectBot(
+    cStockTile& tile,
+    int& xp,
+    int& yp,
+    int& x_size,
+    int& y_size,
+    bool scanHoriz
+)
 {
     bool xr_ok = true;
     bool xl_ok = scanHoriz;
@@ -212,7 +298,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep right x direction
         if (xr_ok) {
             int tx = xp + x_size;
-            if (tx >= m_x) {
+            if (tx >= tile.x1) {
                 xr_ok = false;
             }
             else {
@@ -231,7 +317,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep left x direction
         if (xl_ok) {
             int tx = xp - 1;
-            if (tx < 0) {
+            if (tx < tile.x0) {
                 xl_ok = false;
             }
             else {
@@ -251,7 +337,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep up y direction
         if (yu_ok) {
             int ty = yp + y_size;
-            if (ty >= m_y) {
+            if (ty >= tile.y1) {
                 yu_ok = false;
             }
             else {
@@ -270,7 +356,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep down y direction
         if (yd_ok) {
             int ty = yp - 1;
-            if (ty < 0) {
+            if (ty < tile.y0) {
                 yd_ok = false;
             }
             else {
@@ -290,21 +376,21 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
 }
 
 
-int cStock::TesselBot(int xp, int yp)
+int cStock::TesselBot(cStockTile& tile, int xp, int yp)
 {
     int x_size, y_size;
-    FindRectBot(xp, yp, x_size, y_size, true);
+    FindRectBot(tile, xp, yp, x_size, y_size, true);
     bool farRect = false;
     while (y_size / x_size > 5) {
         farRect = true;
         yp += x_size * 5;
-        FindRectTop(xp, yp, x_size, y_size, true);
+        FindRectTop(tile, xp, yp, x_size, y_size, true);
     }
 
     while (x_size / y_size > 5) {
         farRect = true;
         xp += y_size * 5;
-        FindRectTop(xp, yp, x_size, y_size, false);
+        FindRectTop(tile, xp, yp, x_size, y_size, false);
     }
 
     // mark all points inside
@@ -319,7 +405,7 @@ int cStock::TesselBot(int xp, int yp)
     Point3D pbr(xp + x_size, yp, m_pz);
     Point3D ptl(xp, yp + y_size, m_pz);
     Point3D ptr(xp + x_size, yp + y_size, m_pz);
-    AddQuad(pbl, ptl, ptr, pbr, facetsOuter);
+    AddQuad(pbl, ptl, ptr, pbr, tile.facetsOuter);
 
     if (farRect) {
         return -1;
@@ -329,36 +415,37 @@ int cStock::TesselBot(int xp, int yp)
 }
 
 
-int cStock::TesselSidesX(int yp)
+int cStock::TesselSidesX(cStockTile& tile, int yp)
 {
     float lastz1 = m_pz;
     if (yp < m_y) {
-        lastz1 = std::max(m_stock[0][yp], m_pz);
+        lastz1 = std::max(m_stock[tile.x0][yp], m_pz);
     }
     float lastz2 = m_pz;
     if (yp > 0) {
-        lastz2 = std::max(m_stock[0][yp - 1], m_pz);
+        lastz2 = std::max(m_stock[tile.x0][yp - 1], m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &tile.facetsInner;
     if (yp == 0 || yp == m_y) {
-        facets = &facetsOuter;
+        facets = &tile.facetsOuter;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
-    int lastpoint = 0;
-    for (int x = 1; x <= m_x; x++) {
+    int lastpoint = tile.x0;
+    for (int x = tile.x0 + 1; x <= tile.x1; x++) {
         float newz1 = m_pz;
-        if (yp < m_y && x < m_x) {
+        if (yp < m_y && x < tile.x1) {
             newz1 = std::max(m_stock[x][yp], m_pz);
         }
         float newz2 = m_pz;
-        if (yp > 0 && x < m_x) {
+        if (yp > 0 && x < tile.x1) {
             newz2 = std::max(m_stock[x][yp - 1], m_pz);
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
-            if (fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
+            // the side ends at the tile border
+            if (x < tile.x1 && fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
                 continue;
             }
             Point3D pbl(lastpoint, yp, lastz1);
@@ -374,36 +461,37 @@ int cStock::TesselSidesX(int yp)
     return 0;
 }
 
-int cStock::TesselSidesY(int xp)
+int cStock::TesselSidesY(cStockTile& tile, int xp)
 {
     float lastz1 = m_pz;
     if (xp < m_x) {
-        lastz1 = std::max(m_stock[xp][0], m_pz);
+        lastz1 = std::max(m_stock[xp][tile.y0], m_pz);
     }
     float lastz2 = m_pz;
     if (xp > 0) {
-        lastz2 = std::max(m_stock[xp - 1][0], m_pz);
+        lastz2 = std::max(m_stock[xp - 1][tile.y0], m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &tile.facetsInner;
     if (xp == 0 || xp == m_x) {
-        facets = &facetsOuter;
+        facets = &tile.facetsOuter;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
-    int lastpoint = 0;
-    for (int y = 1; y <= m_y; y++) {
+    int lastpoint = tile.y0;
+    for (int y = tile.y0 + 1; y <= tile.y1; y++) {
         float newz1 = m_pz;
-        if (xp < m_x && y < m_y) {
+        if (xp < m_x && y < tile.y1) {
             newz1 = std::max(m_stock[xp][y], m_pz);
         }
         float newz2 = m_pz;
-        if (xp > 0 && y < m_y) {
+        if (xp > 0 && y < tile.y1) {
             newz2 = std::max(m_stock[xp - 1][y], m_pz);
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
-            if (fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
+            // the side ends at the tile border
+            if (y < tile.y1 && fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
                 continue;
             }
             Point3D pbr(xp, lastpoint, lastz1);
@@ -448,46 +536,89 @@ void cStock::AddQuad(
     facets.push_back(facet);
 }
 
-void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner)
+void cStock::TessellateTile(cStockTile& tile)
 {
     // reset attribs
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             m_attr[x][y] = 0;
         }
     }
 
-    facetsOuter.clear();
-    facetsInner.clear();
+    tile.facetsOuter.clear();
+    tile.facetsInner.clear();
 
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             int attr = m_attr[x][y];
             if ((attr & SIM_TESSEL_TOP) == 0) {
-                x += TesselTop(x, y);
+                x += TesselTop(tile, x, y);
             }
         }
     }
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             if ((m_stock[x][y] - m_pz) < m_res) {
                 m_attr[x][y] |= SIM_TESSEL_BOT;
             }
             if ((m_attr[x][y] & SIM_TESSEL_BOT) == 0) {
-                x += TesselBot(x, y);
+                x += TesselBot(tile, x, y);
             }
         }
     }
-    for (int y = 0; y <= m_y; y++) {
-        TesselSidesX(y);
+
+    // each tile owns the sides on its lower borders, the tiles on the upper
+    // borders of the stock also own the closing sides
+    int ye = tile.y1 == m_y ? m_y : tile.y1 - 1;
+    for (int y = tile.y0; y <= ye; y++) {
+        TesselSidesX(tile, y);
     }
-    for (int x = 0; x <= m_x; x++) {
-        TesselSidesY(x);
+    int xe = tile.x1 == m_x ? m_x : tile.x1 - 1;
+    for (int x = tile.x0; x <= xe; x++) {
+        TesselSidesY(tile, x);
+    }
+    tile.dirty = false;
+}
+
+void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner)
+{
+    // only tiles that changed since the last call are tessellated again
+    std::vector<int> dirtyTiles;
+    for (int i = 0; i < (int)m_tiles.size(); i++) {
+        if (m_tiles[i].dirty) {
+            dirtyTiles.push_back(i);
+        }
+    }
+    OSD_Parallel::For(
+        0,
+        (int)dirtyTiles.size(),
+        [&](int i) { TessellateTile(m_tiles[dirtyTiles[i]]); },
+        dirtyTiles.size() < 2
+    );
+
+    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+    for (const cStockTile& tile : m_tiles) {
+        facetsOuter.insert(facetsOuter.end(), tile.facetsOuter.begin(), tile.facetsOuter.end());
+        facetsInner.insert(facetsInner.end(), tile.facetsInner.begin(), tile.facetsInner.end());
     }
     meshOuter.addFacets(facetsOuter);
     meshInner.addFacets(facetsInner);
-    facetsOuter.clear();
-    facetsInner.clear();
+}
+
+void cStock::MarkDirty(int x0, int y0, int x1, int y1)
+{
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    // the tiles above and on the right share a border with the changed region
+    int tx1 = std::min(m_tx - 1, x1 / SIM_TILE_SIZE);
+    int ty1 = std::min(m_ty - 1, y1 / SIM_TILE_SIZE);
+    for (int ty = y0 / SIM_TILE_SIZE; ty <= ty1; ty++) {
+        for (int tx = x0 / SIM_TILE_SIZE; tx <= tx1; tx++) {
+            m_tiles[ty * m_tx + tx].dirty = true;
+        }
+    }
 }
 
 
@@ -498,7 +629,7 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
     int rad = (int)(radf / m_res);
     int drad = rad * rad;
     int ys = std::max(0, cy - rad);
-    int ye = std::min(m_x, cy + rad);
+    int ye = std::min(m_y, cy + rad);
     int xs = std::max(0, cx - rad);
     int xe = std::min(m_x, cx + rad);
     for (int y = ys; y < ye; y++) {
@@ -510,159 +641,358 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
             }
         }
     }
+    MarkDirty(xs, ys, xe, ye);
+}
+
+void cStock::SetPart(const std::vector<Triangle3D>& triangles, float tolerance)
+{
+    m_part.Init(m_x, m_y);
+    for (int x = 0; x < m_x; x++) {
+        for (int y = 0; y < m_y; y++) {
+            m_part[x][y] = -FLT_MAX;
+        }
+    }
+    m_partTolerance = tolerance;
+
+    // rasterize the top of the part, vertical faces are covered by their neighbours
+    for (const Triangle3D& tri : triangles) {
+        Point3D a = ToInner(tri.points[0]);
+        Point3D b = ToInner(tri.points[1]);
+        Point3D c = ToInner(tri.points[2]);
+        float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        if (fabsf(area) < SIM_EPSILON) {
+            continue;
+        }
+        int xs = std::max(0, (int)floorf(std::min({a.x, b.x, c.x})));
+        int xe = std::min(m_x - 1, (int)ceilf(std::max({a.x, b.x, c.x})));
+        int ys = std::max(0, (int)floorf(std::min({a.y, b.y, c.y})));
+        int ye = std::min(m_y - 1, (int)ceilf(std::max({a.y, b.y, c.y})));
+        for (int x = xs; x <= xe; x++) {
+            float px = x + 0.5f;
+            for (int y = ys; y <= ye; y++) {
+                float py = y + 0.5f;
+                float wa = ((b.x - px) * (c.y - py) - (b.y - py) * (c.x - px)) / area;
+                float wb = ((c.x - px) * (a.y - py) - (c.y - py) * (a.x - px)) / area;
+                float wc = 1.0f - wa - wb;
+                if (wa < -SIM_EPSILON || wb < -SIM_EPSILON || wc < -SIM_EPSILON) {
+                    continue;
+                }
+                float z = wa * a.z + wb * b.z + wc * c.z;
+                m_part[x][y] = std::max(m_part[x][y], z);
+            }
+        }
+    }
+}
+
+cStock::Box cStock::MoveBox(const cSimMove& move, float rad)
+{
+    Point3D p1 = ToInner(move.p1);
+    Point3D p2 = ToInner(move.p2);
+    float xmin = std::min(p1.x, p2.x);
+    float xmax = std::max(p1.x, p2.x);
+    float ymin = std::min(p1.y, p2.y);
+    float ymax = std::max(p1.y, p2.y);
+    if (move.type != cSimMove::Linear) {
+        // add the extreme points of the arc
+        Point3D cent(move.cent.x / m_res, move.cent.y / m_res, 0);
+        ArcGeometry arc = MakeArc(p1, p2, cent, move.type == cSimMove::ArcCCW);
+        for (int i = 0; i < 4; i++) {
+            float ang = (float)(i * pi / 2);
+            if (ArcPosition(arc, ang) <= arc.sweep) {
+                float x = arc.cx + arc.radius * cosf(ang);
+                float y = arc.cy + arc.radius * sinf(ang);
+                xmin = std::min(xmin, x);
+                xmax = std::max(xmax, x);
+                ymin = std::min(ymin, y);
+                ymax = std::max(ymax, y);
+            }
+        }
+    }
+    Box box;
+    box.x0 = std::max(0, (int)floorf(xmin - rad) - 1);
+    box.y0 = std::max(0, (int)floorf(ymin - rad) - 1);
+    box.x1 = std::min(m_x, (int)ceilf(xmax + rad) + 1);
+    box.y1 = std::min(m_y, (int)ceilf(ymax + rad) + 1);
+    return box;
 }
 
-void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
-{
-    // translate coordinates
-    Point3D pi1 = ToInner(p1);
-    Point3D pi2 = ToInner(p2);
-    float rad = tool.radius;
-    rad /= m_res;
-    float cupAngle = 180;
-
-    // strait motion
-    float perpDirX = 1;
-    float perpDirY = 0;
-    cLineSegment path(pi1, pi2);
-    if (path.lenXY > SIM_EPSILON)  // only if moving along xy
-    {
-        perpDirX = -path.pDirXY.y;
-        perpDirY = path.pDirXY.x;
-        Point3D start(perpDirX * rad + pi1.x, perpDirY * rad + pi1.y, pi1.z);
-        Point3D mainWay = path.pDir * SIM_WALK_RES;
-        Point3D sideWay(-perpDirX * SIM_WALK_RES, -perpDirY * SIM_WALK_RES, 0);
-        int lenSteps = (int)(path.len / SIM_WALK_RES) + 1;
-        int radSteps = (int)(rad * 2 / SIM_WALK_RES) + 1;
-        float zstep = (pi2.z - pi1.z) / radSteps;
-        float tstep = 2.0 / radSteps;
-        float t = -1;
-        for (int j = 0; j < radSteps; j++) {
-            float z = pi1.z + tool.GetToolProfileAt(t);
-            Point3D p = start;
-            for (int i = 0; i < lenSteps; i++) {
-                int x = (int)p.x;
-                int y = (int)p.y;
-                if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                    if (m_stock[x][y] > z) {
-                        m_stock[x][y] = z;
+inline bool cStock::CutPixel(int x, int y, float z, float top, MoveResult& result)
+{
+    float& h = m_stock[x][y];
+    if (h <= z) {
+        return false;
+    }
+    if (h > top) {
+        result.holderHit = true;
+    }
+    float cut = h - std::max(z, m_pz);
+    if (cut > SIM_MIN_CUT) {
+        result.removed += cut;
+        if (m_part.IsValid()) {
+            float limit = m_part[x][y] - m_partTolerance;
+            float gouge = std::min(h, limit) - std::max(z, m_pz);
+            if (gouge > SIM_MIN_CUT) {
+                result.gouged += gouge;
+            }
+        }
+    }
+    h = z;
+    return true;
+}
+
+void cStock::ApplyMoveToTile(
+    const cSimMove& move,
+    cSimTool& tool,
+    cStockTile& tile,
+    MoveResult& result
+)
+{
+    Point3D p1 = ToInner(move.p1);
+    Point3D p2 = ToInner(move.p2);
+    float rad = std::max(0.5f, tool.radius / m_res);
+    float rad2 = rad * rad;
+    Box box = MoveBox(move, rad);
+    box.x0 = std::max(box.x0, tile.x0);
+    box.y0 = std::max(box.y0, tile.y0);
+    box.x1 = std::min(box.x1, tile.x1);
+    box.y1 = std::min(box.y1, tile.y1);
+
+    int changedX = -1;
+    int changedY = -1;
+
+    if (move.type == cSimMove::Linear) {
+        float dx = p2.x - p1.x;
+        float dy = p2.y - p1.y;
+        float dz = p2.z - p1.z;
+        float len = sqrtf(dx * dx + dy * dy);
+        bool plunge = len < SIM_EPSILON;
+        float ux = plunge ? 0 : dx / len;
+        float uy = plunge ? 0 : dy / len;
+        for (int x = box.x0; x < box.x1; x++) {
+            // the swept area on this column is the union of the two end discs and the
+            // band between them
+            float vx = x + 0.5f - p1.x;
+            float ylo = FLT_MAX;
+            float yhi = -FLT_MAX;
+            for (const Point3D* p : {&p1, &p2}) {
+                float d = x + 0.5f - p->x;
+                if (fabsf(d) <= rad) {
+                    float h = sqrtf(rad2 - d * d);
+                    ylo = std::min(ylo, p->y - h);
+                    yhi = std::max(yhi, p->y + h);
+                }
+            }
+            float c0, c1, s0, s1;
+            if (!plunge && SolveRange(ux, -vx * uy, -rad, rad, c0, c1)
+                && SolveRange(uy, vx * ux, 0, len, s0, s1)) {
+                float lo = std::max(c0, s0);
+                float hi = std::min(c1, s1);
+                if (lo <= hi) {
+                    ylo = std::min(ylo, p1.y + lo);
+                    yhi = std::max(yhi, p1.y + hi);
+                }
+            }
+            if (ylo > yhi) {
+                continue;
+            }
+            int ys = std::max(box.y0, (int)floorf(ylo - 0.5f));
+            int ye = std::min(box.y1, (int)ceilf(yhi - 0.5f) + 1);
+            for (int y = ys; y < ye; y++) {
+                float vy = y + 0.5f - p1.y;
+                float s = vx * ux + vy * uy;
+                float sc = std::clamp(s, 0.0f, len);
+                float qx = vx - sc * ux;
+                float qy = vy - sc * uy;
+                float d2 = qx * qx + qy * qy;
+                if (d2 > rad2) {
+                    continue;
+                }
+                float f = plunge ? (dz < 0 ? 1.0f : 0.0f) : sc / len;
+                float tip = p1.z * (1 - f) + p2.z * f;
+                float z = tip + tool.ProfileAt(sqrtf(d2) / rad);
+                if (!plunge && dz != 0) {
+                    // on a ramp the lower end of the chord through the pixel may cut deeper
+                    float perp = vx * -uy + vy * ux;
+                    float h = sqrtf(std::max(0.0f, rad2 - perp * perp));
+                    float se = dz < 0 ? std::min(s + h, len) : std::max(s - h, 0.0f);
+                    float de2 = perp * perp + (s - se) * (s - se);
+                    if (de2 <= rad2) {
+                        float fe = se / len;
+                        float tipe = p1.z * (1 - fe) + p2.z * fe;
+                        float ze = tipe + tool.ProfileAt(sqrtf(de2) / rad);
+                        if (ze < z) {
+                            z = ze;
+                            tip = tipe;
+                        }
                     }
                 }
-                p.Add(mainWay);
-                z += zstep;
+                if (CutPixel(x, y, z, tip + tool.length, result)) {
+                    changedX = std::max(changedX, x);
+                    changedY = std::max(changedY, y);
+                }
             }
-            t += tstep;
-            start.Add(sideWay);
         }
     }
     else {
-        cupAngle = 360;
-    }
-
-    // end cup
-    for (float r = 0.5f; r <= rad; r += (float)SIM_WALK_RES) {
-        Point3D cupCirc(perpDirX * r, perpDirY * r, pi2.z);
-        float rotang = 180 * SIM_WALK_RES / (pi * r);
-        cupCirc.SetRotationAngle(-rotang);
-        float z = pi2.z + tool.GetToolProfileAt(r / rad);
-        for (float a = 0; a < cupAngle; a += rotang) {
-            int x = (int)(pi2.x + cupCirc.x);
-            int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
+        Point3D cent(move.cent.x / m_res, move.cent.y / m_res, 0);
+        ArcGeometry arc = MakeArc(p1, p2, cent, move.type == cSimMove::ArcCCW);
+        for (int x = box.x0; x < box.x1; x++) {
+            float ax = x + 0.5f - arc.cx;
+            for (int y = box.y0; y < box.y1; y++) {
+                float ay = y + 0.5f - arc.cy;
+                float z = FLT_MAX;
+                float tip = 0;
+                float dr = fabsf(sqrtf(ax * ax + ay * ay) - arc.radius);
+                if (dr <= rad) {
+                    float pos = ArcPosition(arc, atan2f(ay, ax));
+                    if (pos <= arc.sweep) {
+                        float f = pos / arc.sweep;
+                        tip = p1.z * (1 - f) + p2.z * f;
+                        z = tip + tool.ProfileAt(dr / rad);
+                    }
+                }
+                // end cups
+                for (const Point3D* p : {&p1, &p2}) {
+                    float ex = x + 0.5f - p->x;
+                    float ey = y + 0.5f - p->y;
+                    float d2 = ex * ex + ey * ey;
+                    if (d2 <= rad2) {
+                        float ze = p->z + tool.ProfileAt(sqrtf(d2) / rad);
+                        if (ze < z) {
+                            z = ze;
+                            tip = p->z;
+                        }
+                    }
+                }
+                if (z < FLT_MAX && CutPixel(x, y, z, tip + tool.length, result)) {
+                    changedX = std::max(changedX, x);
+                    changedY = std::max(changedY, y);
                 }
             }
-            cupCirc.Rotate();
+        }
+    }
+
+    if (changedX >= 0) {
+        tile.dirty = true;
+        if (changedX == tile.x1 - 1) {
+            tile.dirtyRight = true;
+        }
+        if (changedY == tile.y1 - 1) {
+            tile.dirtyTop = true;
         }
     }
 }
 
-void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW)
+void cStock::ApplyMoves(const std::vector<cSimMove>& moves, cSimTool& tool)
 {
-    // translate coordinates
-    Point3D pi1 = ToInner(p1);
-    Point3D pi2 = ToInner(p2);
-    Point3D centi(cent.x / m_res, cent.y / m_res, cent.z);
-    float rad = tool.radius;
-    rad /= m_res;
-    float cpx = centi.x;
-    float cpy = centi.y;
-
-    Point3D xynorm = unit(Point3D(-cpx, -cpy, 0));
-    float crad = sqrt(cpx * cpx + cpy * cpy);
-    float crad1 = std::max((float)0.5, crad - rad);
-    float crad2 = crad + rad;
-
-    float sang = atan2(-cpy, -cpx);  // start angle
-
-    cpx += pi1.x;
-    cpy += pi1.y;
-    double eang = atan2(pi2.y - cpy, pi2.x - cpx);  // end angle
-
-    double ang = eang - sang;
-    if (!isCCW && ang > 0) {
-        ang -= 2 * pi;
-    }
-    if (isCCW && ang < 0) {
-        ang += 2 * pi;
-    }
-    ang = fabs(ang);
-
-    // apply path
-    Point3D cupCirc;
-    float tstep = (float)SIM_WALK_RES / rad;
-    float t = -1;
-    for (float r = crad1; r <= crad2; r += (float)SIM_WALK_RES) {
-        cupCirc.x = xynorm.x * r;
-        cupCirc.y = xynorm.y * r;
-        float rotang = (float)SIM_WALK_RES / r;
-        int ndivs = (int)(ang / rotang) + 1;
-        if (!isCCW) {
-            rotang = -rotang;
-        }
-        cupCirc.SetRotationAngleRad(rotang);
-        float z = pi1.z + tool.GetToolProfileAt(t);
-        float zstep = (pi2.z - pi1.z) / ndivs;
-        for (int i = 0; i < ndivs; i++) {
-            int x = (int)(cpx + cupCirc.x);
-            int y = (int)(cpy + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+    // distribute the moves to the tiles they touch. Each tile applies its moves in
+    // order, so every pixel sees the same sequence of cuts as in a serial run.
+    float rad = std::max(0.5f, tool.radius / m_res);
+    std::vector<std::vector<int>> tileMoves(m_tiles.size());
+    for (int i = 0; i < (int)moves.size(); i++) {
+        Box box = MoveBox(moves[i], rad);
+        if (box.x0 >= box.x1 || box.y0 >= box.y1) {
+            continue;
+        }
+        for (int ty = box.y0 / SIM_TILE_SIZE; ty <= (box.y1 - 1) / SIM_TILE_SIZE; ty++) {
+            for (int tx = box.x0 / SIM_TILE_SIZE; tx <= (box.x1 - 1) / SIM_TILE_SIZE; tx++) {
+                tileMoves[ty * m_tx + tx].push_back(i);
             }
-            z += zstep;
-            cupCirc.Rotate();
-        }
-        t += tstep;
-    }
-
-    // apply end cup
-    xynorm.SetRotationAngleRad(ang);
-    xynorm.Rotate();
-    for (float r = 0.5f; r <= rad; r += (float)SIM_WALK_RES) {
-        Point3D cupCirc(xynorm.x * r, xynorm.y * r, 0);
-        float rotang = (float)SIM_WALK_RES / r;
-        int ndivs = (int)(pi / rotang) + 1;
-        if (!isCCW) {
-            rotang = -rotang;
-        }
-        cupCirc.SetRotationAngleRad(rotang);
-        float z = pi2.z + tool.GetToolProfileAt(r / rad);
-        for (int i = 0; i < ndivs; i++) {
-            int x = (int)(pi2.x + cupCirc.x);
-            int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+        }
+    }
+    std::vector<int> activeTiles;
+    for (int i = 0; i < (int)m_tiles.size(); i++) {
+        if (!tileMoves[i].empty()) {
+            activeTiles.push_back(i);
+        }
+    }
+
+    std::vector<std::vector<MoveResult>> tileResults(activeTiles.size());
+    OSD_Parallel::For(
+        0,
+        (int)activeTiles.size(),
+        [&](int i) {
+            int t = activeTiles[i];
+            const std::vector<int>& ids = tileMoves[t];
+            tileResults[i].resize(ids.size());
+            for (std::size_t j = 0; j < ids.size(); j++) {
+                ApplyMoveToTile(moves[ids[j]], tool, m_tiles[t], tileResults[i][j]);
+            }
+        },
+        activeTiles.size() < 2
+    );
+
+    // the neighbours of changed tile borders have to be tessellated again
+    for (int ty = 0; ty < m_ty; ty++) {
+        for (int tx = 0; tx < m_tx; tx++) {
+            cStockTile& tile = m_tiles[ty * m_tx + tx];
+            if (tile.dirtyRight && tx + 1 < m_tx) {
+                m_tiles[ty * m_tx + tx + 1].dirty = true;
+            }
+            if (tile.dirtyTop && ty + 1 < m_ty) {
+                m_tiles[(ty + 1) * m_tx + tx].dirty = true;
+            }
+            tile.dirtyRight = false;
+            tile.dirtyTop = false;
+        }
+    }
+
+    // sum up the results of the tiles in a fixed order
+    std::vector<MoveResult> results(moves.size());
+    for (std::size_t i = 0; i < activeTiles.size(); i++) {
+        const std::vector<int>& ids = tileMoves[activeTiles[i]];
+        for (std::size_t j = 0; j < ids.size(); j++) {
+            const MoveResult& res = tileResults[i][j];
+            results[ids[j]].removed += res.removed;
+            results[ids[j]].gouged += res.gouged;
+            results[ids[j]].holderHit |= res.holderHit;
+        }
+    }
+    double pixelArea = (double)m_res * m_res;
+    for (std::size_t i = 0; i < moves.size(); i++) {
+        int index = m_stats.moves++;
+        const MoveResult& res = results[i];
+        bool cutting = res.removed > 0;
+        if (cutting) {
+            m_stats.cuttingMoves++;
+            if (moves[i].rapid) {
+                m_stats.rapidCollisions++;
             }
-            cupCirc.Rotate();
         }
+        if (res.holderHit) {
+            m_stats.holderCollisions++;
+        }
+        if ((cutting && moves[i].rapid) || res.holderHit) {
+            m_stats.collisionMoves.push_back(index);
+        }
+        if (res.gouged > 0) {
+            m_stats.gouges++;
+            m_stats.gougeMoves.push_back(index);
+        }
+        m_stats.removedVolume += res.removed * pixelArea;
+        m_stats.gougeVolume += res.gouged * pixelArea;
     }
 }
 
+void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool, bool rapid)
+{
+    cSimMove move;
+    move.p1 = p1;
+    move.p2 = p2;
+    move.rapid = rapid;
+    ApplyMoves({move}, tool);
+}
+
+void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW)
+{
+    cSimMove move;
+    move.p1 = p1;
+    move.p2 = p2;
+    move.cent = cent;
+    move.type = isCCW ? cSimMove::ArcCCW : cSimMove::ArcCW;
+    ApplyMoves({move}, tool);
+}
+
 
 //************************************************************************************************************
 // Line Segment
@@ -774,6 +1104,11 @@ cSimTool::cSimTool(const TopoDS_Shape& toolShape, float res)
         }
     }
 
+    m_profile.resize(SIM_PROFILE_SAMPLES);
+    for (int i = 0; i < SIM_PROFILE_SAMPLES; i++) {
+        m_profile[i] = GetToolProfileAt((float)i / (SIM_PROFILE_SAMPLES - 1));
+    }
+
     // Report the performance of the profile extraction
     // auto stop = std::chrono::high_resolution_clock::now();
     // auto duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
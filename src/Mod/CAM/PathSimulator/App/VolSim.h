@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include <Mod/Mesh/App/Mesh.h>
@@ -35,8 +37,9 @@
 #define SIM_EPSILON 0.00001
 #define SIM_TESSEL_TOP 1
 #define SIM_TESSEL_BOT 2
-#define SIM_WALK_RES \
-    0.6  // step size in pixel units (to make sure all pixels in the path are visited)
+#define SIM_MIN_CUT 0.0001       // thinner layers are not counted as removed material
+#define SIM_TILE_SIZE 64         // stock tile size in pixels
+#define SIM_PROFILE_SAMPLES 256  // number of samples in the tool profile lookup table
 
 struct toolShapePoint
 {
@@ -178,11 +181,18 @@ public:
     {}
 
     float GetToolProfileAt(float pos);
+    // fast lookup of the tool profile, pos is 0..1 location along the radius
+    inline float ProfileAt(float pos) const
+    {
+        int idx = (int)ceilf(pos * (SIM_PROFILE_SAMPLES - 1));
+        return m_profile[std::clamp(idx, 0, SIM_PROFILE_SAMPLES - 1)];
+    }
     bool isInside(const TopoDS_Shape& toolShape, Base::Vector3d pnt, float res);
 
     /* m_toolShape has to be populated with linearly increased
        radiusPos to get the tool profile at given position */
     std::vector<toolShapePoint> m_toolShape;
+    std::vector<float> m_profile;
     float radius;
     float length;
 };
@@ -205,6 +215,7 @@ public:
 
     void Init(int x, int y)
     {
+        delete[] data;
         data = new T[x * y];
         height = y;
     }
@@ -214,11 +225,57 @@ public:
         return data + i * height;
     }
 
+    bool IsValid() const
+    {
+        return data != nullptr;
+    }
+
 private:
     T* data;
     int height;
 };
 
+// a single tool motion, positions are in world coordinates
+struct cSimMove
+{
+    enum MoveType
+    {
+        Linear,
+        ArcCW,
+        ArcCCW
+    };
+    Point3D p1;
+    Point3D p2;
+    Point3D cent;  // arc center relative to p1
+    MoveType type = Linear;
+    bool rapid = false;
+};
+
+// statistics accumulated over all moves since the stock was created
+struct cSimStats
+{
+    int moves = 0;
+    int cuttingMoves = 0;      // moves that removed material
+    int rapidCollisions = 0;   // rapid moves that removed material
+    int holderCollisions = 0;  // moves where the material reached above the tool length
+    int gouges = 0;            // moves that cut into the part
+    double removedVolume = 0;
+    double gougeVolume = 0;
+    std::vector<int> collisionMoves;  // indices of colliding moves
+    std::vector<int> gougeMoves;      // indices of gouging moves
+};
+
+// a square region of the stock, tessellated independently of the other tiles
+struct cStockTile
+{
+    int x0, y0, x1, y1;  // pixel range
+    bool dirty = true;
+    bool dirtyTop = false;    // top row changed, the tile above has to be tessellated again
+    bool dirtyRight = false;  // right column changed, same for the tile on the right
+    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+};
+
 class cStock
 {
 public:
@@ -226,16 +283,48 @@ public:
     ~cStock();
     void Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner);
     void CreatePocket(float x, float y, float rad, float height);
-    void ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool);
+    void ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool, bool rapid = false);
     void ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW);
-    inline Point3D ToInner(Point3D& p)
+    // apply moves in order, the stock tiles are processed concurrently
+    void ApplyMoves(const std::vector<cSimMove>& moves, cSimTool& tool);
+    // set the part used for gouge detection, triangles are in world coordinates
+    void SetPart(const std::vector<Triangle3D>& triangles, float tolerance);
+    const cSimStats& GetStats() const
+    {
+        return m_stats;
+    }
+    float GetResolution() const
+    {
+        return m_res;
+    }
+    inline Point3D ToInner(const Point3D& p)
     {
         return Point3D((p.x - m_px) / m_res, (p.y - m_py) / m_res, p.z);
     }
 
 private:
-    float FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
-    void FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
+    struct MoveResult
+    {
+        double removed = 0;
+        double gouged = 0;
+        bool holderHit = false;
+    };
+    struct Box
+    {
+        int x0, y0, x1, y1;
+    };
+    Box MoveBox(const cSimMove& move, float rad);
+    void ApplyMoveToTile(
+        const cSimMove& move,
+        cSimTool& tool,
+        cStockTile& tile,
+        MoveResult& result
+    );
+    inline bool CutPixel(int x, int y, float z, float top, MoveResult& result);
+    void MarkDirty(int x0, int y0, int x1, int y1);
+    void TessellateTile(cStockTile& tile);
+    float FindRectTop(cStockTile& tile, int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
+    void FindRectBot(cStockTile& tile, int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3);
     void AddQuad(
         Point3D& p1,
@@ -244,19 +333,22 @@ private:
         Point3D& p4,
         std::vector<MeshCore::MeshGeomFacet>& facets
     );
-    int TesselTop(int x, int y);
-    int TesselBot(int x, int y);
-    int TesselSidesX(int yp);
-    int TesselSidesY(int xp);
+    int TesselTop(cStockTile& tile, int x, int y);
+    int TesselBot(cStockTile& tile, int x, int y);
+    int TesselSidesX(cStockTile& tile, int yp);
+    int TesselSidesY(cStockTile& tile, int xp);
     Array2D<float> m_stock;
     Array2D<char> m_attr;
+    Array2D<float> m_part;  // part top height, used for gouge detection
+    float m_partTolerance = 0;
     float m_px, m_py, m_pz;  // stock zero position
     float m_lx, m_ly, m_lz;  // stock dimensions
     float m_res;             // resoulution
     float m_plane;           // stock plane height
     int m_x, m_y;            // stock array size
-    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
-    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+    int m_tx, m_ty;          // number of tiles
+    std::vector<cStockTile> m_tiles;
+    cSimStats m_stats;
 };
 
 class cVolSim
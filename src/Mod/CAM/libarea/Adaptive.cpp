@@ -28,7 +28,14 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
 #include <numbers>
+#include <thread>
 
 namespace ClipperLib
 {
@@ -963,30 +970,59 @@ PerfCounter Perf_IsClearPath("IsClearPath");
 //***********************************
 // Cleared area bounding support
 //***********************************
+// Version stamps of the cleared area tiles, unique over all instances so that
+// the tiles of copies can be compared
+std::atomic<unsigned long long> tileVersionCounter {0};
+
+// The cleared area grows with every expansion, so next to the full paths it is
+// also kept in square tiles. Each tile holds the cleared area within the tile,
+// grown by a small margin so that the pieces of neighbouring tiles overlap.
+// Expanding the cleared area and querying the area around the tool then only
+// run Clipper on the tiles nearby. The expansions are merged into the full
+// paths in one go when these are requested.
 class ClearedArea
 {
 public:
     ClearedArea(ClipperLib::cInt p_toolRadiusScaled)
     {
         toolRadiusScaled = p_toolRadiusScaled;
+        tileSize = max<cInt>(toolRadiusScaled * TILE_SIZE_TOOL_RADII, MIN_TILE_SIZE);
+        tileMargin = max<cInt>(toolRadiusScaled / 16, MIN_TILE_MARGIN);
     };
 
     void SetClearedPaths(const Paths& paths)
     {
         clearedPaths = paths;
+        pendingPaths.clear();
+        tiles.clear();
+        AddToTiles(paths, PolyFillType::pftEvenOdd);
         bboxPathsInvalid = true;
+        bboxWindowInvalid = true;
+        bboxClippedInvalid = true;
+    }
+
+    // copy the cleared area of another instance with the same tool
+    void SetCleared(const ClearedArea& other)
+    {
+        clearedPaths = other.clearedPaths;
+        pendingPaths = other.pendingPaths;
+        tiles = other.tiles;
+        bboxPathsInvalid = true;
+        bboxWindowInvalid = true;
         bboxClippedInvalid = true;
     }
 
     void AddClearedPaths(const Paths& paths)
     {
+        // normalize the orientation, the pending paths are merged as non-zero
+        Paths oriented;
         clip.Clear();
-        clip.AddPaths(clearedPaths, PolyType::ptSubject, true);
-        clip.AddPaths(paths, PolyType::ptClip, true);
-        clip.Execute(ClipType::ctUnion, clearedPaths);
-        CleanPolygons(clearedPaths);
+        clip.AddPaths(paths, PolyType::ptSubject, true);
+        clip.Execute(ClipType::ctUnion, oriented);
+        AddToTiles(oriented, PolyFillType::pftNonZero);
+        AddToWindow(oriented);
+        pendingPaths.insert(pendingPaths.end(), oriented.begin(), oriented.end());
         bboxPathsInvalid = true;
-        bboxClippedInvalid = true;
     }
 
     void ExpandCleared(const Path toClearToolPath)
@@ -999,13 +1035,10 @@ public:
         clipof.AddPath(toClearToolPath, JoinType::jtRound, EndType::etOpenRound);
         Paths toolCoverPoly;
         clipof.Execute(toolCoverPoly, toolRadiusScaled + 1);
-        clip.Clear();
-        clip.AddPaths(clearedPaths, PolyType::ptSubject, true);
-        clip.AddPaths(toolCoverPoly, PolyType::ptClip, true);
-        clip.Execute(ClipType::ctUnion, clearedPaths);
-        CleanPolygons(clearedPaths);
+        AddToTiles(toolCoverPoly, PolyFillType::pftNonZero);
+        AddToWindow(toolCoverPoly);
+        pendingPaths.insert(pendingPaths.end(), toolCoverPoly.begin(), toolCoverPoly.end());
         bboxPathsInvalid = true;
-        bboxClippedInvalid = true;
         Perf_ExpandCleared.Stop();
     }
 
@@ -1019,7 +1052,7 @@ public:
         }
 
         // second, check if the window needs to be recomputed
-        if (bboxClippedInvalid || !clearedBBWindow.Contains(toolBB)) {
+        if (bboxWindowInvalid || !clearedBBWindow.Contains(toolBB)) {
             const int deltaWindow = delta * clearedBoundedWindowScale;
             clearedBBWindow.SetFirstPoint(IntPoint(toolPos.X - deltaWindow, toolPos.Y - deltaWindow));
             clearedBBWindow.AddPoint(IntPoint(toolPos.X + deltaWindow, toolPos.Y + deltaWindow));
@@ -1031,8 +1064,25 @@ public:
             bbPath.push_back(IntPoint(toolPos.X - deltaWindow, toolPos.Y + deltaWindow));
             clip.Clear();
             clip.AddPath(bbPath, PolyType::ptSubject, true);
-            clip.AddPaths(clearedPaths, PolyType::ptClip, true);
-            clip.Execute(ClipType::ctIntersection, clearedBoundedWindow);
+            // the tiles overlap, hence the non-zero fill
+            for (cInt ty = TileIndex(clearedBBWindow.minY); ty <= TileIndex(clearedBBWindow.maxY);
+                 ty++) {
+                for (cInt tx = TileIndex(clearedBBWindow.minX);
+                     tx <= TileIndex(clearedBBWindow.maxX);
+                     tx++) {
+                    auto it = tiles.find({tx, ty});
+                    if (it != tiles.end()) {
+                        clip.AddPaths(it->second.paths, PolyType::ptClip, true);
+                    }
+                }
+            }
+            clip.Execute(
+                ClipType::ctIntersection,
+                clearedBoundedWindow,
+                PolyFillType::pftEvenOdd,
+                PolyFillType::pftNonZero
+            );
+            bboxWindowInvalid = false;
         }
 
         // finally, perform the query using data from the window
@@ -1053,25 +1103,233 @@ public:
         return clearedBoundedClipped;
     }
 
+    // get area cleared since the given (earlier) copy of this cleared area
+    double GetAreaClearedSince(const ClearedArea& before)
+    {
+        double area = 0;
+        for (const auto& [index, tile] : tiles) {
+            auto it = before.tiles.find(index);
+            if (it != before.tiles.end() && it->second.version == tile.version) {
+                continue;
+            }
+            Paths added;
+            clip.Clear();
+            clip.AddPaths(tile.paths, PolyType::ptSubject, true);
+            if (it != before.tiles.end()) {
+                clip.AddPaths(it->second.paths, PolyType::ptClip, true);
+            }
+            clip.Execute(ClipType::ctDifference, added);
+            // count only the part within the tile, as the tiles overlap
+            clip.Clear();
+            clip.AddPaths(added, PolyType::ptSubject, true);
+            clip.AddPath(TileRect(index.first, index.second, 0), PolyType::ptClip, true);
+            clip.Execute(ClipType::ctIntersection, added);
+            for (const Path& a : added) {
+                int nesting = getPathNestingLevel(a, added);
+                area += (nesting % 2 == 1 ? 1 : -1) * fabs(Area(a));
+            }
+        }
+        return area;
+    }
+
+    // get the cleared area around the given paths, the tiles overlap so the
+    // result must be used with non-zero fill
+    Paths GetClearedNear(const Paths& paths)
+    {
+        Paths near;
+        BoundBox bb;
+        bool first = true;
+        for (const Path& path : paths) {
+            for (const auto& pt : path) {
+                if (first) {
+                    bb.SetFirstPoint(pt);
+                    first = false;
+                }
+                else {
+                    bb.AddPoint(pt);
+                }
+            }
+        }
+        if (first) {
+            return near;
+        }
+        for (cInt ty = TileIndex(bb.minY); ty <= TileIndex(bb.maxY); ty++) {
+            for (cInt tx = TileIndex(bb.minX); tx <= TileIndex(bb.maxX); tx++) {
+                auto it = tiles.find({tx, ty});
+                if (it != tiles.end()) {
+                    near.insert(near.end(), it->second.paths.begin(), it->second.paths.end());
+                }
+            }
+        }
+        return near;
+    }
+
     // get full cleared area
     Paths& GetCleared()
     {
+        if (!pendingPaths.empty()) {
+            clip.Clear();
+            clip.AddPaths(clearedPaths, PolyType::ptSubject, true);
+            clip.AddPaths(pendingPaths, PolyType::ptClip, true);
+            clip.Execute(
+                ClipType::ctUnion,
+                clearedPaths,
+                PolyFillType::pftEvenOdd,
+                PolyFillType::pftNonZero
+            );
+            CleanPolygons(clearedPaths);
+            pendingPaths.clear();
+        }
         return clearedPaths;
     }
 
 private:
+    struct Tile
+    {
+        Paths paths;
+        unsigned long long version = 0;
+    };
+
+    cInt TileIndex(cInt coord) const
+    {
+        // round towards negative infinity
+        return coord >= 0 ? coord / tileSize : -((-coord - 1) / tileSize) - 1;
+    }
+
+    Path TileRect(cInt tx, cInt ty, cInt margin) const
+    {
+        Path rect;
+        rect.push_back(IntPoint(tx * tileSize - margin, ty * tileSize - margin));
+        rect.push_back(IntPoint((tx + 1) * tileSize + margin, ty * tileSize - margin));
+        rect.push_back(IntPoint((tx + 1) * tileSize + margin, (ty + 1) * tileSize + margin));
+        rect.push_back(IntPoint(tx * tileSize - margin, (ty + 1) * tileSize + margin));
+        return rect;
+    }
+
+    // update the window of the bounded queries, much cheaper than recomputing it
+    void AddToWindow(const Paths& paths)
+    {
+        if (bboxWindowInvalid) {
+            return;
+        }
+        Path bbPath;
+        bbPath.push_back(IntPoint(clearedBBWindow.minX, clearedBBWindow.minY));
+        bbPath.push_back(IntPoint(clearedBBWindow.maxX, clearedBBWindow.minY));
+        bbPath.push_back(IntPoint(clearedBBWindow.maxX, clearedBBWindow.maxY));
+        bbPath.push_back(IntPoint(clearedBBWindow.minX, clearedBBWindow.maxY));
+        Paths piece;
+        clip.Clear();
+        clip.AddPath(bbPath, PolyType::ptSubject, true);
+        clip.AddPaths(paths, PolyType::ptClip, true);
+        clip.Execute(
+            ClipType::ctIntersection,
+            piece,
+            PolyFillType::pftEvenOdd,
+            PolyFillType::pftNonZero
+        );
+        if (piece.empty()) {
+            // the query in focus lies within the window, so it is still valid
+            return;
+        }
+        clip.Clear();
+        clip.AddPaths(clearedBoundedWindow, PolyType::ptSubject, true);
+        clip.AddPaths(piece, PolyType::ptClip, true);
+        clip.Execute(ClipType::ctUnion, clearedBoundedWindow);
+        CleanPolygons(clearedBoundedWindow);
+        bboxClippedInvalid = true;
+    }
+
+    void AddToTiles(const Paths& paths, PolyFillType fillType)
+    {
+        vector<BoundBox> pathBBs;
+        pathBBs.reserve(paths.size());
+        BoundBox bb;
+        bool first = true;
+        for (const Path& path : paths) {
+            if (path.empty()) {
+                pathBBs.emplace_back();
+                continue;
+            }
+            BoundBox pathBB(path.front());
+            for (const auto& pt : path) {
+                pathBB.AddPoint(pt);
+            }
+            pathBBs.push_back(pathBB);
+            if (first) {
+                bb = pathBB;
+                first = false;
+            }
+            else {
+                bb.AddPoint(IntPoint(pathBB.minX, pathBB.minY));
+                bb.AddPoint(IntPoint(pathBB.maxX, pathBB.maxY));
+            }
+        }
+        if (first) {
+            return;
+        }
+
+        for (cInt ty = TileIndex(bb.minY - tileMargin); ty <= TileIndex(bb.maxY + tileMargin);
+             ty++) {
+            for (cInt tx = TileIndex(bb.minX - tileMargin); tx <= TileIndex(bb.maxX + tileMargin);
+                 tx++) {
+                Path rect = TileRect(tx, ty, tileMargin);
+                BoundBox rectBB(rect[0], rect[2]);
+                clip.Clear();
+                clip.AddPath(rect, PolyType::ptSubject, true);
+                bool any = false;
+                for (size_t i = 0; i < paths.size(); i++) {
+                    // paths outside of the tile do not affect the fill within it
+                    if (!paths[i].empty() && pathBBs[i].CollidesWith(rectBB)) {
+                        clip.AddPath(paths[i], PolyType::ptClip, true);
+                        any = true;
+                    }
+                }
+                if (!any) {
+                    continue;
+                }
+                Paths piece;
+                clip.Execute(ClipType::ctIntersection, piece, PolyFillType::pftEvenOdd, fillType);
+                if (piece.empty()) {
+                    continue;
+                }
+                Tile& tile = tiles[{tx, ty}];
+                if (tile.paths.empty()) {
+                    tile.paths = std::move(piece);
+                }
+                else {
+                    clip.Clear();
+                    clip.AddPaths(tile.paths, PolyType::ptSubject, true);
+                    clip.AddPaths(piece, PolyType::ptClip, true);
+                    clip.Execute(ClipType::ctUnion, tile.paths);
+                }
+                CleanPolygons(tile.paths);
+                tile.version = ++tileVersionCounter;
+            }
+        }
+    }
+
+    // tile size in tool radii, about a third of the window used for the bounded queries
+    static constexpr cInt TILE_SIZE_TOOL_RADII = 8;
+    static constexpr cInt MIN_TILE_SIZE = 256;
+    static constexpr cInt MIN_TILE_MARGIN = 8;
+
     Clipper clip;
     ClipperOffset clipof;
     Paths clearedPaths;
+    Paths pendingPaths;  // expansions not yet merged into clearedPaths
     Paths clearedBoundedWindow;
     Paths clearedBoundedClipped;
     Paths clearedBoundedPaths;
+    std::map<std::pair<cInt, cInt>, Tile> tiles;
 
     ClipperLib::cInt toolRadiusScaled;
+    cInt tileSize;
+    cInt tileMargin;
     BoundBox clearedBBWindow;
     BoundBox clearedBBClippedInFocus;
     BoundBox clearedBBPathsInFocus;
 
+    bool bboxWindowInvalid = true;
     bool bboxClippedInvalid = false;
     bool bboxPathsInvalid = false;
     int clearedBoundedWindowScale = 10;
@@ -1802,6 +2060,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(
     // clipof.Execute(toolBounds, -(toolRadiusScaled + finishPassOffsetScaled));
 
     // 7) Loop over connected components using nesting level.
+    std::vector<AdaptiveRegion> regions;
     for (const auto& current : toolBounds) {
         // nesting counts itself and the number of polygons containing it
         int nesting = getPathNestingLevel(current, toolBounds);
@@ -1871,14 +2130,121 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(
                 }
             }
 
-            // 10) Run core algorithm on (bounds, toolBounds, finishingPass, clearedArea)
-            ProcessPolyNode(boundPath, currentTBP, finishingPass, initialClearedPaths);
+            regions.push_back({boundPath, currentTBP, finishingPass});
         }
     }
 
+    // 10) Run core algorithm on (bounds, toolBounds, finishingPass, clearedArea)
+    ProcessRegions(regions, initialClearedPaths);
+
     return results;
 }
 
+// Collects the progress of the regions processed in worker threads, so that the
+// progress callback, which calls into python, is only called from the thread
+// running Execute()
+struct ProgressQueue
+{
+    std::mutex mutex;
+    std::condition_variable finished;
+    TPaths progressPaths;
+    size_t running = 0;
+    bool stop = false;
+};
+
+void Adaptive2d::ProcessRegions(
+    const std::vector<AdaptiveRegion>& regions,
+    const Paths& initialClearedPaths
+)
+{
+    size_t threadCount = min<size_t>(regions.size(), std::thread::hardware_concurrency());
+#ifdef DEV_MODE
+    threadCount = 1;  // debug drawing and performance counters are not thread safe
+#endif
+    if (!parallelRegions || threadCount < 2) {
+        for (const AdaptiveRegion& region : regions) {
+            ProcessPolyNode(
+                region.boundPaths,
+                region.toolBoundPaths,
+                region.finishingPaths,
+                initialClearedPaths
+            );
+        }
+        return;
+    }
+
+    // Each region is processed by a copy of this object, and the results are
+    // appended in the order of the regions, same as when processed serially
+    ProgressQueue queue;
+    queue.running = threadCount;
+    std::vector<std::list<AdaptiveOutput>> regionResults(regions.size());
+    std::vector<std::exception_ptr> errors(regions.size());
+    std::atomic<size_t> nextRegion {0};
+
+    auto worker = [&]() {
+        for (size_t i = nextRegion++; i < regions.size(); i = nextRegion++) {
+            Adaptive2d regionAdaptive(*this);
+            regionAdaptive.results.clear();
+            regionAdaptive.progressCallback = nullptr;
+            regionAdaptive.progressQueue = &queue;
+            regionAdaptive.current_region = int(i);
+            try {
+                regionAdaptive.ProcessPolyNode(
+                    regions[i].boundPaths,
+                    regions[i].toolBoundPaths,
+                    regions[i].finishingPaths,
+                    initialClearedPaths
+                );
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.stop = true;
+            }
+            regionResults[i] = std::move(regionAdaptive.results);
+        }
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.running--;
+        queue.finished.notify_one();
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        threads.emplace_back(worker);
+    }
+
+    // forward the progress of the workers until all regions are done
+    const auto interval = std::chrono::milliseconds(1000 * PROGRESS_TICKS / CLOCKS_PER_SEC);
+    bool done = false;
+    while (!done) {
+        TPaths progressPaths;
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            done = queue.finished.wait_for(lock, interval, [&]() { return queue.running == 0; });
+            progressPaths.swap(queue.progressPaths);
+        }
+        if (!progressPaths.empty() && progressCallback && (*progressCallback)(progressPaths)) {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.stop = true;
+        }
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (queue.stop) {
+        stopProcessing = true;
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    for (auto& regionResult : regionResults) {
+        results.splice(results.end(), regionResult);
+    }
+}
+
 bool Adaptive2d::FindEntryPoint(
     TPaths& progressPaths,
     const Paths& toolBoundPaths,
@@ -2029,9 +2395,14 @@ bool Adaptive2d::IsClearPath(const Path& tp, ClearedArea& cleared, double safety
     Paths toolShape;
     clipof.Execute(toolShape, toolRadiusScaled + safetyClearance);
     clip.AddPaths(toolShape, PolyType::ptSubject, true);
-    clip.AddPaths(cleared.GetCleared(), PolyType::ptClip, true);
+    clip.AddPaths(cleared.GetClearedNear(toolShape), PolyType::ptClip, true);
     Paths crossing;
-    clip.Execute(ClipType::ctDifference, crossing);
+    clip.Execute(
+        ClipType::ctDifference,
+        crossing,
+        PolyFillType::pftEvenOdd,
+        PolyFillType::pftNonZero
+    );
     double collisionArea = 0;
     for (auto& p : crossing) {
         collisionArea += fabs(Area(p));
@@ -2297,7 +2668,7 @@ bool Adaptive2d::MakeLeadPath(
 
     // make a copy of clearedArea to update as the path progresses (for lead out only)
     ClearedArea clearedArea(toolRadiusScaled);
-    clearedArea.SetClearedPaths(clearedAreaOriginal.GetCleared());
+    clearedArea.SetCleared(clearedAreaOriginal);
 
     // compute acceptable tool end locations
     ClipperOffset clipof;
@@ -2678,7 +3049,19 @@ void Adaptive2d::CheckReportProgress(TPaths& progressPaths, bool force)
     if (progressPaths.empty()) {
         return;
     }
-    if (progressCallback) {
+    if (progressQueue) {
+        // hand over to the thread calling the python function
+        std::lock_guard<std::mutex> lock(progressQueue->mutex);
+        progressQueue->progressPaths.insert(
+            progressQueue->progressPaths.end(),
+            progressPaths.begin(),
+            progressPaths.end()
+        );
+        if (progressQueue->stop) {
+            stopProcessing = true;
+        }
+    }
+    else if (progressCallback) {
         if ((*progressCallback)(progressPaths)) {
             stopProcessing = true;  // call python function, if returns true signal stop processing
         }
@@ -2894,7 +3277,7 @@ void Adaptive2d::ProcessPolyNode(
     clock_t start_clock = clock();
 #endif
     ClearedArea clearedBeforePass(toolRadiusScaled);
-    clearedBeforePass.SetClearedPaths(cleared.GetCleared());
+    clearedBeforePass.SetCleared(cleared);
 
     DoublePoint lastExpandToolDir = toolDir;
 
@@ -3593,16 +3976,7 @@ void Adaptive2d::ProcessPolyNode(
             toClearPath.clear();
         }
 
-        Paths newlyClearedAreas;
-        clip.Clear();
-        clip.AddPaths(cleared.GetCleared(), PolyType::ptSubject, true);
-        clip.AddPaths(clearedBeforePass.GetCleared(), PolyType::ptClip, true);
-        clip.Execute(ClipType::ctDifference, newlyClearedAreas);
-        cumulativeCutArea = 0;
-        for (Path& a : newlyClearedAreas) {
-            int nesting = getPathNestingLevel(a, newlyClearedAreas);
-            cumulativeCutArea += (nesting % 2 == 1 ? 1 : -1) * fabs(Area(a));
-        }
+        cumulativeCutArea = cleared.GetAreaClearedSince(clearedBeforePass);
 
         if (cumulativeCutArea >= 1) {
             Path cleaned;
@@ -3626,7 +4000,7 @@ void Adaptive2d::ProcessPolyNode(
             break;
         }
 
-        clearedBeforePass.SetClearedPaths(cleared.GetCleared());
+        clearedBeforePass.SetCleared(cleared);
         engagePoint = getEngagePoint({toolPos});
         if (engagePoint) {
             toolPos = std::get<IntPoint>(*engagePoint);
@@ -69,6 +69,7 @@ typedef std::pair<int, DPath> TPath;  // first parameter is MotionType, must use
                                       // with serialization to JSON in python
 
 class ClearedArea;
+struct ProgressQueue;
 
 typedef std::vector<TPath> TPaths;
 
@@ -90,7 +91,15 @@ struct AdaptiveOutput
     bool FinishingLeadInFailed = false;
 };
 
-// used to isolate state -> enable potential adding of multi-threaded processing of separate regions
+// separate regions to clear, processed concurrently
+struct AdaptiveRegion
+{
+    Paths boundPaths;
+    Paths toolBoundPaths;
+    Paths finishingPaths;
+};
+
+// used to isolate state -> enables multi-threaded processing of separate regions
 
 class Adaptive2d
 {
@@ -106,6 +115,7 @@ public:
     bool finishingProfile = true;
     double keepToolDownDistRatio = 3.0;  // keep tool down distance ratio
     OperationType opType = OperationType::otClearingInside;
+    bool parallelRegions = true;  // process separate regions concurrently
 
     std::list<AdaptiveOutput> Execute(
         const DPaths& stockPaths,
@@ -138,8 +148,13 @@ private:
     clock_t lastProgressTime = 0;
 
     std::function<bool(TPaths)>* progressCallback = NULL;
+    ProgressQueue* progressQueue = nullptr;  // set when processing a region in a worker thread
     Path toolGeometry;  // tool geometry at coord 0,0, should not be modified
 
+    void ProcessRegions(
+        const std::vector<AdaptiveRegion>& regions,
+        const Paths& initialClearedPaths
+    );
     void ProcessPolyNode(
         Paths boundPaths,
         Paths toolBoundPaths,
@@ -17,7 +17,7 @@ bool CArea::HolesLinked()
 }
 
 // static const double PI = 3.1415926535897932;
-double CArea::m_clipper_scale = 10000.0;
+thread_local double CArea::m_clipper_scale = 10000.0;
 
 class DoubleAreaPoint
 {
@@ -40,7 +40,7 @@ public:
     }
 };
 
-static std::list<DoubleAreaPoint> pts_for_AddVertex;
+static thread_local std::list<DoubleAreaPoint> pts_for_AddVertex;
 
 static void AddPoint(const DoubleAreaPoint& p)
 {
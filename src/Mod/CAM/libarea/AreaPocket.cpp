@@ -11,7 +11,7 @@
 #include <map>
 #include <set>
 
-static const CAreaPocketParams* pocket_params = NULL;
+static thread_local const CAreaPocketParams* pocket_params = NULL;
 
 class IslandAndOffset
 {
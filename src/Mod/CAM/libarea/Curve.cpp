@@ -13,7 +13,7 @@ const Point operator*(const double& d, const Point& p)
 {
     return p * d;
 }
-double Point::tolerance = 0.001;
+thread_local double Point::tolerance = 0.001;
 
 // static const double PI = 3.1415926535897932; duplicated in kurve/geometry.h
 
@@ -316,7 +316,7 @@ static bool DoesIntersInterfere(const Point& pInt, const Kurve& k, double offset
 }  // namespace geoff_geometry
 
 
-static struct iso
+static thread_local struct iso
 {
     Span sp;
     Span off;
@@ -440,6 +440,7 @@ void init_pyarea(py::module& m)
         .def_readwrite("finishingProfile", &Adaptive2d::finishingProfile)
         .def_readwrite("tolerance", &Adaptive2d::tolerance)
         .def_readwrite("keepToolDownDistRatio", &Adaptive2d::keepToolDownDistRatio)
+        .def_readwrite("parallelRegions", &Adaptive2d::parallelRegions)
         .def_readwrite("opType", &Adaptive2d::opType);
 }
 
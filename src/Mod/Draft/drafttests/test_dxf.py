@@ -35,6 +35,7 @@
 # @{
 
 import os
+import tempfile
 
 import FreeCAD as App
 import Draft
@@ -47,13 +48,8 @@ import importDXF
 class DraftDXF(test_base.DraftTestCaseDoc):
     """Test reading and writing of DXF files with Draft."""
 
-    def test_read_dxf_Issue24314(self):
-        """Verify that reading a DXF file does not leave pending Python error states"""
-
-        file = "Mod/Draft/drafttests/Issue24314.dxf"
-        in_file = os.path.join(App.getHomePath(), file)
-        _msg("  file={}".format(in_file))
-        _msg("  exists={}".format(os.path.exists(in_file)))
+    def _count_imported_objects(self, in_file):
+        """Open a DXF file with the C++ importer and return the number of created objects"""
 
         hGrp = App.ParamGet("User parameter:BaseApp/Preferences/Mod/Draft")
 
@@ -69,7 +65,7 @@ class DraftDXF(test_base.DraftTestCaseDoc):
         try:
             # disable Preferences dialog in gui mode (avoids popup prompt to user)
             hGrp.SetBool("dxfShowDialog", False)
-            # Use the new C++ importer -- that's where the bug was
+            # Use the new C++ importer
             hGrp.SetBool("dxfUseLegacyImporter", False)
             # Preserve the DXF layers (makes the checking of document contents easier)
             hGrp.SetBool("dxfUseDraftVisGroups", True)
@@ -81,8 +77,7 @@ class DraftDXF(test_base.DraftTestCaseDoc):
             hGrp.SetBool("dxfCreateSketch", False)
             hGrp.SetBool("dxfstarblocks", False)
             doc = importDXF.open(in_file)
-            # This doc should have 3 objects: The Layers container, the DXF layer called 0, and one Line
-            self.assertEqual(len(doc.Objects), 3)
+            return len(doc.Objects)
         finally:
             hGrp.SetBool("dxfShowDialog", wasShowDialog)
             hGrp.SetBool("dxfUseLegacyImporter", wasUseLegacyImporter)
@@ -93,6 +88,43 @@ class DraftDXF(test_base.DraftTestCaseDoc):
             if doc:
                 App.closeDocument(doc.Name)
 
+    def test_read_dxf_Issue24314(self):
+        """Verify that reading a DXF file does not leave pending Python error states"""
+
+        file = "Mod/Draft/drafttests/Issue24314.dxf"
+        in_file = os.path.join(App.getHomePath(), file)
+        _msg("  file={}".format(in_file))
+        _msg("  exists={}".format(os.path.exists(in_file)))
+
+        # This doc should have 3 objects: The Layers container, the DXF layer called 0, and one Line
+        self.assertEqual(self._count_imported_objects(in_file), 3)
+
+    def test_read_dxf_line_endings(self):
+        """Verify that the records are read the same whatever the line endings of the file"""
+
+        file = "Mod/Draft/drafttests/Issue24314.dxf"
+        with open(os.path.join(App.getHomePath(), file), encoding="ascii") as f:
+            lines = f.read().splitlines()
+
+        # Group codes may have a plus sign, like any integer a stream reads
+        signed = [
+            line.replace(line.strip(), "+" + line.strip()) if i % 2 == 0 else line
+            for i, line in enumerate(lines)
+        ]
+        variants = {
+            "crlf": "\r\n".join(lines) + "\r\n",
+            "crlf_no_trailing_newline": "\r\n".join(lines),
+            "lf_no_trailing_newline": "\n".join(lines),
+            "plus_group_codes": "\n".join(signed) + "\n",
+        }
+        with tempfile.TemporaryDirectory() as temp_dir:
+            for name, content in variants.items():
+                with self.subTest(variant=name):
+                    in_file = os.path.join(temp_dir, name + ".dxf")
+                    with open(in_file, "w", encoding="ascii", newline="") as f:
+                        f.write(content)
+                    self.assertEqual(self._count_imported_objects(in_file), 3)
+
     def test_export_dxf(self):
         """Create some figures and export them to a DXF file."""
         operation = "importDXF.export"
@@ -21,14 +21,23 @@
  ***************************************************************************/
 
 #include <Python.h>
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
 #include <memory>
 
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass_FaceClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepTools.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <GeomAPI_ProjectPointOnCurve.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <Precision.hxx>
 #include <SMDS_MeshGroup.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
@@ -47,13 +56,16 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
 
 #include <boost/assign/list_of.hpp>
+#include <fmt/format.h>
 #include <boost/tokenizer.hpp>  //to simplify parsing input files we use the boost lib
 
 #include <App/Application.h>
@@ -137,6 +149,7 @@ FemMesh& FemMesh::operator=(const FemMesh& mesh)
 
 void FemMesh::copyMeshData(const FemMesh& mesh)
 {
+    clearNodeIndex();
     _Mtrx = mesh._Mtrx;
 
     // 1. Get source mesh
@@ -271,6 +284,8 @@ const SMESH_Mesh* FemMesh::getSMesh() const
 
 SMESH_Mesh* FemMesh::getSMesh()
 {
+    // the caller may change the nodes
+    clearNodeIndex();
     return myMesh;
 }
 
@@ -330,6 +345,7 @@ void FemMesh::setStandardHypotheses()
 
 void FemMesh::compute()
 {
+    clearNodeIndex();
     getGenerator()->Compute(*myMesh, myMesh->GetShapeToMesh());
 }
 
@@ -569,60 +585,202 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
-std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+namespace Fem
 {
-    std::set<int> result;
 
-    Bnd_Box box;
-    BRepBndLib::Add(solid, box);
+/*! Mesh nodes in global coordinates, sorted along the x axis.
+ * All nodes inside a bounding box are found with a binary search on x
+ * followed by a check of y and z, instead of testing every node of the mesh.
+ */
+class NodeIndex
+{
+public:
+    NodeIndex(const SMESHDS_Mesh* mesh, const Base::Matrix4D& mat)
+        : transform(mat)
+    {
+        std::vector<std::pair<gp_Pnt, int>> nodes;
+        nodes.reserve(mesh->NbNodes());
+        SMDS_NodeIteratorPtr aNodeIter = mesh->nodesIterator();
+        while (aNodeIter->more()) {
+            const SMDS_MeshNode* aNode = aNodeIter->next();
+            Base::Vector3d vec(aNode->X(), aNode->Y(), aNode->Z());
+            // Apply the matrix to hold the BoundBox in absolute space.
+            vec = mat * vec;
+            nodes.emplace_back(gp_Pnt(vec.x, vec.y, vec.z), aNode->GetID());
+        }
 
-    // limit where the mesh node belongs to the solid
-    TopAbs_ShapeEnum shapetype = TopAbs_SHAPE;
-    ShapeAnalysis_ShapeTolerance analysis;
-    double limit = analysis.Tolerance(solid, 1, shapetype);
-    Base::Console().log("The limit if a node is in or out: %.12lf in scientific: %.4e \n", limit, limit);
+        std::sort(nodes.begin(), nodes.end(), [](const auto& a, const auto& b) {
+            return a.first.X() < b.first.X();
+        });
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+        points.reserve(nodes.size());
+        ids.reserve(nodes.size());
+        for (const auto& it : nodes) {
+            points.push_back(it.first);
+            ids.push_back(it.second);
+        }
+    }
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
+    /// indices of all nodes inside \a box
+    std::vector<std::size_t> find(const Bnd_Box& box) const
+    {
+        std::vector<std::size_t> result;
+        if (box.IsVoid()) {
+            return result;
+        }
+
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        auto first = std::lower_bound(points.begin(), points.end(), xmin, [](const gp_Pnt& p, double x) {
+            return p.X() < x;
+        });
+        for (auto it = first; it != points.end() && it->X() <= xmax; ++it) {
+            if (!box.IsOut(*it)) {
+                result.push_back(it - points.begin());
+            }
+        }
+        return result;
     }
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
+    const gp_Pnt& point(std::size_t index) const
+    {
+        return points[index];
+    }
 
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+    int id(std::size_t index) const
+    {
+        return ids[index];
+    }
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
+    /// a safety net for changes of the mesh that were not notified
+    bool matches(const SMESHDS_Mesh* mesh, const Base::Matrix4D& mat) const
+    {
+        return static_cast<std::size_t>(mesh->NbNodes()) == ids.size() && transform == mat;
+    }
+
+private:
+    Base::Matrix4D transform;
+    std::vector<gp_Pnt> points;
+    std::vector<int> ids;
+};
+
+}  // namespace Fem
+
+namespace
+{
+
+/*! Checks if points lie on a face.
+ * The point is projected onto the underlying surface, which is bounded by the
+ * parametric range of the face. Points farther away than the limit are rejected
+ * right away, the others are classified in the parameter space of the face.
+ * Only if this is inconclusive the exact distance to the face is computed.
+ * An instance must not be shared between threads.
+ */
+class FaceProbe
+{
+public:
+    FaceProbe(const TopoDS_Face& face, double limit)
+        : face(face)
+        , limit(limit)
+    {
+        surface = BRep_Tool::Surface(face);
+        if (!surface.IsNull()) {
+            double umin, umax, vmin, vmax;
+            BRepTools::UVBounds(face, umin, umax, vmin, vmax);
+            projector.Init(surface, umin, umax, vmin, vmax);
+        }
+    }
+
+    bool contains(const gp_Pnt& pnt)
+    {
+        if (!surface.IsNull()) {
+            projector.Perform(pnt);
+            if (projector.NbPoints() > 0) {
+                if (projector.LowerDistance() >= limit) {
+                    return false;
+                }
+
+                double u, v;
+                projector.LowerDistanceParameters(u, v);
+                BRepClass_FaceClassifier classifier(face, gp_Pnt2d(u, v), Precision::PConfusion());
+                if (classifier.State() != TopAbs_OUT) {
+                    return true;
+                }
             }
         }
+
+        return isNearShape(face, pnt, limit);
     }
-    return result;
-}
 
-std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
+    static bool isNearShape(const TopoDS_Shape& shape, const gp_Pnt& pnt, double limit)
+    {
+        // create a vertex
+        BRepBuilderAPI_MakeVertex aBuilder(pnt);
+        TopoDS_Shape s = aBuilder.Vertex();
+        // measure distance
+        BRepExtrema_DistShapeShape measure(shape, s);
+        measure.Perform();
+        if (!measure.IsDone() || measure.NbSolution() < 1) {
+            return false;
+        }
+
+        return measure.Value() < limit;
+    }
+
+private:
+    const TopoDS_Face& face;
+    double limit;
+    Handle(Geom_Surface) surface;
+    GeomAPI_ProjectPointOnSurf projector;
+};
+
+/*! Checks if points lie on an edge.
+ * The distance to an edge is the smaller one of the distance to its end
+ * points and the distance to the interior extrema of its curve.
+ * An instance must not be shared between threads.
+ */
+class EdgeProbe
+{
+public:
+    EdgeProbe(const TopoDS_Edge& edge, double limit)
+        : edge(edge)
+        , limit(limit)
+    {
+        double first, last;
+        curve = BRep_Tool::Curve(edge, first, last);
+        if (!curve.IsNull()) {
+            start = curve->Value(first);
+            end = curve->Value(last);
+            projector.Init(curve, first, last);
+        }
+    }
+
+    bool contains(const gp_Pnt& pnt)
+    {
+        if (curve.IsNull()) {
+            // degenerated edge
+            return FaceProbe::isNearShape(edge, pnt, limit);
+        }
+
+        double dist = std::min(pnt.Distance(start), pnt.Distance(end));
+        if (dist < limit) {
+            return true;
+        }
+
+        projector.Perform(pnt);
+        return projector.NbPoints() > 0 && projector.LowerDistance() < limit;
+    }
+
+private:
+    const TopoDS_Edge& edge;
+    double limit;
+    Handle(Geom_Curve) curve;
+    gp_Pnt start;
+    gp_Pnt end;
+    GeomAPI_ProjectPointOnCurve projector;
+};
+
+std::set<int> findNodesOnFace(const NodeIndex& index, const TopoDS_Face& face)
 {
     std::set<int> result;
 
@@ -636,43 +794,87 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    std::vector<std::size_t> candidates = index.find(box);
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
+#pragma omp parallel
+    {
+        FaceProbe probe(face, limit);
+#pragma omp for schedule(dynamic, 64)
+        for (long i = 0; i < static_cast<long>(candidates.size()); ++i) {
+            std::size_t node = candidates[i];
+            if (probe.contains(index.point(node)))
+#pragma omp critical
+            {
+                result.insert(index.id(node));
+            }
+        }
     }
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
+    return result;
+}
 
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+}  // namespace
+
+std::shared_ptr<const NodeIndex> FemMesh::getNodeIndex() const
+{
+    std::lock_guard<std::mutex> lock(nodeIndexMutex);
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    // the index is in global coordinates, so it depends on the current transform
+    if (!nodeIndex || !nodeIndex->matches(meshDS, getTransform())) {
+        nodeIndex = std::make_shared<NodeIndex>(meshDS, getTransform());
+    }
+    return nodeIndex;
+}
+
+void FemMesh::clearNodeIndex()
+{
+    std::lock_guard<std::mutex> lock(nodeIndexMutex);
+    nodeIndex.reset();
+}
+
+std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+{
+    std::set<int> result;
+
+    Bnd_Box box;
+    BRepBndLib::Add(solid, box);
+
+    // limit where the mesh node belongs to the solid
+    TopAbs_ShapeEnum shapetype = TopAbs_SHAPE;
+    ShapeAnalysis_ShapeTolerance analysis;
+    double limit = analysis.Tolerance(solid, 1, shapetype);
+    Base::Console().log("The limit if a node is in or out: %.12lf in scientific: %.4e \n", limit, limit);
 
-            if (measure.Value() < limit)
+    std::shared_ptr<const NodeIndex> nodes = getNodeIndex();
+    const NodeIndex& index = *nodes;
+    std::vector<std::size_t> candidates = index.find(box);
+
+#pragma omp parallel for schedule(dynamic)
+    for (long i = 0; i < static_cast<long>(candidates.size()); ++i) {
+        std::size_t node = candidates[i];
+        if (FaceProbe::isNearShape(solid, index.point(node), limit))
 #pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+        {
+            result.insert(index.id(node));
         }
     }
+    return result;
+}
+
+std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
+{
+    return findNodesOnFace(*getNodeIndex(), face);
+}
+
+std::vector<std::set<int>> FemMesh::getNodesByFaces(const std::vector<TopoDS_Face>& faces) const
+{
+    std::vector<std::set<int>> result;
+    result.reserve(faces.size());
+
+    std::shared_ptr<const NodeIndex> index = getNodeIndex();
+    for (const auto& face : faces) {
+        result.push_back(findNodesOnFace(*index, face));
+    }
 
     return result;
 }
@@ -687,40 +889,20 @@ std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    std::shared_ptr<const NodeIndex> nodes = getNodeIndex();
+    const NodeIndex& index = *nodes;
+    std::vector<std::size_t> candidates = index.find(box);
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
+#pragma omp parallel
+    {
+        EdgeProbe probe(edge, limit);
+#pragma omp for schedule(dynamic, 64)
+        for (long i = 0; i < static_cast<long>(candidates.size()); ++i) {
+            std::size_t node = candidates[i];
+            if (probe.contains(index.point(node)))
 #pragma omp critical
             {
-                result.insert(aNode->GetID());
+                result.insert(index.id(node));
             }
         }
     }
@@ -1630,6 +1812,7 @@ void FemMesh::readZ88(const std::string& FileName)
 
 void FemMesh::read(const char* FileName)
 {
+    clearNodeIndex();
     Base::FileInfo File(FileName);
     _Mtrx = Base::Matrix4D();
 
@@ -1680,6 +1863,7 @@ void FemMesh::read(const char* FileName)
 
 void FemMesh::readVTKWithGroups(const char* FileName, const char* vtk_group_cell_array)
 {
+    clearNodeIndex();
 #ifdef FC_USE_VTK
     Base::FileInfo File(FileName);
     if (File.hasExtension({"vtk", "vtu", "pvtu"})) {
@@ -1716,6 +1900,61 @@ void FemMesh::writeVTKWithGroups(
 #endif
 }
 
+namespace
+{
+
+/*! Writes the lines of a node or element block of an inp file.
+ * The entries are formatted by \a format in chunks on several threads and
+ * written to the stream in their original order. Only a limited number of
+ * chunks is kept in memory at a time.
+ */
+template<typename Container, typename Formatter>
+void writeInpBlock(std::ostream& output, const Container& entries, Formatter format)
+{
+    constexpr std::size_t chunkSize = 4096;
+    constexpr std::size_t chunksPerBatch = 64;
+
+    std::vector<const typename Container::value_type*> items;
+    items.reserve(entries.size());
+    for (const auto& it : entries) {
+        items.push_back(&it);
+    }
+
+    const std::size_t numChunks = (items.size() + chunkSize - 1) / chunkSize;
+    std::vector<std::string> buffers(std::min(numChunks, chunksPerBatch));
+
+    for (std::size_t firstChunk = 0; firstChunk < numChunks; firstChunk += chunksPerBatch) {
+        const long batchSize = static_cast<long>(std::min(chunksPerBatch, numChunks - firstChunk));
+
+#pragma omp parallel for schedule(dynamic)
+        for (long i = 0; i < batchSize; ++i) {
+            std::string& buffer = buffers[i];
+            buffer.clear();
+            std::size_t begin = (firstChunk + i) * chunkSize;
+            std::size_t end = std::min(begin + chunkSize, items.size());
+            for (std::size_t j = begin; j < end; ++j) {
+                format(buffer, *items[j]);
+            }
+        }
+
+        for (long i = 0; i < batchSize; ++i) {
+            output.write(buffers[i].data(), static_cast<std::streamsize>(buffers[i].size()));
+        }
+    }
+}
+
+void writeInpElement(std::string& out, const std::pair<const int, std::vector<int>>& element)
+{
+    auto inserter = std::back_inserter(out);
+    fmt::format_to(inserter, "{}", element.first);
+    for (int kt : element.second) {
+        fmt::format_to(inserter, ", {}", kt);
+    }
+    out += '\n';
+}
+
+}  // namespace
+
 void FemMesh::writeABAQUS(
     const std::string& Filename,
     int elemParam,
@@ -2122,12 +2361,18 @@ void FemMesh::writeABAQUS(
 
     // This way we get sorted output.
     // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
-    for (const auto& it : vertexMap) {
-        anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
-    }
+    writeInpBlock(anABAQUS_Output, vertexMap, [](std::string& out, const auto& it) {
+        // same as the stream precision of 13 significant digits
+        fmt::format_to(
+            std::back_inserter(out),
+            "{}, {:.13g}, {:.13g}, {:.13g}\n",
+            it.first,
+            it.second.x,
+            it.second.y,
+            it.second.z
+        );
+    });
     anABAQUS_Output << std::endl << std::endl;
-    ;
 
 
     // write volumes to file
@@ -2136,27 +2381,21 @@ void FemMesh::writeABAQUS(
         for (const auto& it : elementsMapVol) {
             anABAQUS_Output << "** Volume elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
+            writeInpBlock(anABAQUS_Output, it.second, [](std::string& out, const auto& jt) {
+                auto inserter = std::back_inserter(out);
+                fmt::format_to(inserter, "{}", jt.first);
                 // Calculix allows max 16 entries in one line, a hexa20 has more !
                 int ct = 0;  // counter
-                bool first_line = true;
                 for (auto kt = jt.second.begin(); kt != jt.second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output << ", " << *kt;
+                    if (ct == 15) {
+                        fmt::format_to(inserter, ",\n{}", *kt);
                     }
                     else {
-                        if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
-                            first_line = false;
-                        }
-                        else {
-                            anABAQUS_Output << ", " << *kt;
-                        }
+                        fmt::format_to(inserter, ", {}", *kt);
                     }
                 }
-                anABAQUS_Output << std::endl;
-            }
+                out += '\n';
+            });
         }
         elsetname += "Evolumes";
         anABAQUS_Output << std::endl;
@@ -2167,13 +2406,7 @@ void FemMesh::writeABAQUS(
         for (const auto& it : elementsMapFac) {
             anABAQUS_Output << "** Face elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeInpBlock(anABAQUS_Output, it.second, writeInpElement);
         }
         if (elsetname.empty()) {
             elsetname += "Efaces";
@@ -2189,13 +2422,7 @@ void FemMesh::writeABAQUS(
         for (const auto& it : elementsMapEdg) {
             anABAQUS_Output << "** Edge elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeInpBlock(anABAQUS_Output, it.second, writeInpElement);
         }
         if (elsetname.empty()) {
             elsetname += "Eedges";
@@ -2472,6 +2699,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     file.close();
 
     // read the shape from the temp file
+    clearNodeIndex();
     myMesh->UNVToMesh(fi.filePath().c_str());
 
     // delete the temp file
@@ -2481,6 +2709,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
+    clearNodeIndex();
     Base::Matrix4D clMatrix(rclTrf);
     SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
     Base::Vector3d current_node;
@@ -2495,6 +2724,7 @@ void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 void FemMesh::setTransform(const Base::Matrix4D& rclTrf)
 {
     // Placement handling, no geometric transformation
+    clearNodeIndex();
     _Mtrx = rclTrf;
 }
 
@@ -24,6 +24,8 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 
 #include <SMDSAbs_ElementType.hxx>
@@ -77,6 +79,8 @@ enum class ABAQUS_EdgeVariant
 
 using SMESH_HypothesisPtr = std::shared_ptr<SMESH_Hypothesis>;
 
+class NodeIndex;
+
 /** The representation of a FemMesh
  */
 class FemExport FemMesh: public Data::ComplexGeoData
@@ -133,6 +137,8 @@ public:
     std::set<int> getNodesBySolid(const TopoDS_Solid& solid) const;
     /// retrieving by face
     std::set<int> getNodesByFace(const TopoDS_Face& face) const;
+    /// retrieving by faces, the result contains one set per face
+    std::vector<std::set<int>> getNodesByFaces(const std::vector<TopoDS_Face>& faces) const;
     /// retrieving by edge
     std::set<int> getNodesByEdge(const TopoDS_Edge& edge) const;
     /// retrieving by vertex
@@ -245,6 +251,10 @@ private:
     void readNastran95(const std::string& Filename);
     void readZ88(const std::string& Filename);
     void readAbaqus(const std::string& Filename);
+    /// the node index of the node searches, built on first use
+    std::shared_ptr<const NodeIndex> getNodeIndex() const;
+    /// drop the node index because the nodes may have changed
+    void clearNodeIndex();
 
 private:
     /// positioning matrix
@@ -256,6 +266,9 @@ private:
 
     std::list<SMESH_HypothesisPtr> hypoth;
     static SMESH_Gen* _mesh_gen;
+
+    mutable std::mutex nodeIndexMutex;
+    mutable std::shared_ptr<const NodeIndex> nodeIndex;
 };
 
 
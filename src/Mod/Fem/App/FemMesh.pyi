@@ -221,6 +221,12 @@ class FemMesh(ComplexGeoData):
         """Return a list of node IDs which belong to a TopoFace"""
         ...
 
+    @constmethod
+    def getNodesByFaces(self, faces: list[TopoShapeFace], /) -> list[list[int]]:
+        """Return for each TopoFace of a list the IDs of the nodes which belong to it.
+        This is faster than calling getNodesByFace for every face."""
+        ...
+
     @constmethod
     def getNodesByEdge(self, edge: TopoShapeEdge, /) -> list[int]:
         """Return a list of node IDs which belong to a TopoEdge"""
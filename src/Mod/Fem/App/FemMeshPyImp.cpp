@@ -1553,6 +1553,50 @@ PyObject* FemMeshPy::getNodesByFace(PyObject* args) const
     }
 }
 
+PyObject* FemMeshPy::getNodesByFaces(PyObject* args) const
+{
+    PyObject* pL;
+    if (!PyArg_ParseTuple(args, "O", &pL)) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<TopoDS_Face> faces;
+        Py::Sequence list(pL);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            PyObject* item = (*it).ptr();
+            if (!PyObject_TypeCheck(item, &(Part::TopoShapeFacePy::Type))) {
+                PyErr_SetString(PyExc_TypeError, "List of faces expected");
+                return nullptr;
+            }
+            const TopoDS_Shape& sh = static_cast<Part::TopoShapeFacePy*>(item)->getTopoShapePtr()->getShape();
+            if (sh.IsNull()) {
+                PyErr_SetString(PyExc_ValueError, "Face is empty");
+                return nullptr;
+            }
+            faces.push_back(TopoDS::Face(sh));
+        }
+
+        Py::List ret;
+        for (const auto& resultSet : getFemMeshPtr()->getNodesByFaces(faces)) {
+            Py::List nodes;
+            for (int it : resultSet) {
+                nodes.append(Py::Long(it));
+            }
+            ret.append(nodes);
+        }
+
+        return Py::new_reference_to(ret);
+    }
+    catch (Standard_Failure& e) {
+        PyErr_SetString(Base::PyExc_FC_CADKernelError, e.GetMessageString());
+        return nullptr;
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+}
+
 PyObject* FemMeshPy::getNodesByEdge(PyObject* args) const
 {
     PyObject* pW;
@@ -129,7 +129,9 @@ bool FemPostPipeline::canRead(Base::FileInfo File)
 {
 
     // from FemResult only unstructural mesh is supported in femvtktoools.cpp
-    return File.hasExtension({"vtk", "vtp", "vts", "vtr", "vti", "vtu", "pvtu", "vtm", "pvd"});
+    return File.hasExtension(
+        {"vtk", "vtp", "vts", "vtr", "vti", "vtu", "pvtu", "vtm", "pvd", "frd"}
+    );
 }
 
 vtkSmartPointer<vtkDataObject> FemPostPipeline::dataObjectFromFile(const Base::FileInfo& File)
@@ -166,10 +168,24 @@ vtkSmartPointer<vtkDataObject> FemPostPipeline::dataObjectFromFile(const Base::F
     else if (File.hasExtension("pvd")) {
         return readPVD(File);
     }
+    else if (File.hasExtension("frd")) {
+        return readFRD(File);
+    }
 
     throw Base::FileException("Unknown extension");
 }
 
+vtkSmartPointer<vtkDataObject> FemPostPipeline::readFRD(const Base::FileInfo& file)
+{
+    // the results are read straight into vtk arrays, without an intermediate file
+    auto multiBlock = FemVTKTools::readFRD(file.filePath().c_str());
+    if (multiBlock->GetNumberOfBlocks() == 0) {
+        throw Base::FileException("No results found in file", file);
+    }
+
+    return multiBlock->GetBlock(0);
+}
+
 vtkSmartPointer<vtkDataObject> FemPostPipeline::readPVD(const Base::FileInfo& file)
 {
     std::string path = file.filePath();
@@ -140,6 +140,8 @@ private:
     vtkSmartPointer<vtkDataObject> dataObjectFromFile(const Base::FileInfo& File);
     // read .pvd file into multiblock dataset
     vtkSmartPointer<vtkDataObject> readPVD(const Base::FileInfo& file);
+    // read the frames of the first analysis type of a CalculiX .frd file
+    vtkSmartPointer<vtkDataObject> readFRD(const Base::FileInfo& file);
 };
 
 }  // namespace Fem
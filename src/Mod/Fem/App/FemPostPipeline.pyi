@@ -40,6 +40,9 @@ class FemPostPipeline(FemPostObject):
         """
         Reads in a single vtk file or creates a multiframe result by reading in multiple result files.
 
+        A CalculiX .frd file is read directly into the pipeline, with one frame per result step
+        of its first analysis type.
+
         If multiframe is wanted, 4 argumenhts are needed:
         1. List of result files each being one frame,
         2. List of values valid for each frame (e.g. [s] if time data),
@@ -2128,7 +2128,7 @@ vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::ifstream& ifstr)
 
 }  // namespace FRDReader
 
-void FemVTKTools::frdToVTK(const char* filename, bool binary)
+vtkSmartPointer<vtkMultiBlockDataSet> FemVTKTools::readFRD(const char* filename)
 {
     Base::FileInfo fi(filename);
 
@@ -2138,7 +2138,14 @@ void FemVTKTools::frdToVTK(const char* filename, bool binary)
 
     std::ifstream ifstr(filename, std::ios::in | std::ios::binary);
 
-    vtkSmartPointer<vtkMultiBlockDataSet> multiBlock = FRDReader::readFRD(ifstr);
+    return FRDReader::readFRD(ifstr);
+}
+
+void FemVTKTools::frdToVTK(const char* filename, bool binary)
+{
+    Base::FileInfo fi(filename);
+
+    vtkSmartPointer<vtkMultiBlockDataSet> multiBlock = readFRD(filename);
 
     std::string dir = fi.dirPath();
 
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <vtkDataSet.h>
+#include <vtkMultiBlockDataSet.h>
 #include <vtkSmartPointer.h>
 #include <vtkUnstructuredGrid.h>
 
@@ -83,6 +84,9 @@ public:
     // write FemResult (activeObject if res= NULL) to vtkUnstructuredGrid dataset file
     static void writeResult(const char* filename, const App::DocumentObject* res = nullptr);
 
+    // read a CalculiX .frd result file, one block of frames per analysis type
+    static vtkSmartPointer<vtkMultiBlockDataSet> readFRD(const char* filename);
+
     static void frdToVTK(const char* filename, bool binary = true);
 
     static void addArrayFromFunction(
@@ -68,7 +68,6 @@ void DlgSettingsFemCcxImp::saveSettings()
     ui->dsb_ccx_minimum_time_increment->onSave();  // Minimum time increment
     ui->dsb_ccx_maximum_time_increment->onSave();  // Maximum time increment
     ui->ckb_pipeline_result->onSave();
-    ui->ckb_result_format->onSave();
 
     ui->cb_analysis_type->onSave();
     ui->cb_BeamShellOutput->onSave();  // Beam shell output 3d or 2d
@@ -93,7 +92,6 @@ void DlgSettingsFemCcxImp::loadSettings()
     ui->dsb_ccx_minimum_time_increment->onRestore();  // Minimum time increment
     ui->dsb_ccx_maximum_time_increment->onRestore();  // Maximum time increment
     ui->ckb_pipeline_result->onRestore();
-    ui->ckb_result_format->onRestore();
 
     ui->cb_analysis_type->onRestore();
     ui->cb_BeamShellOutput->onRestore();  // Beam shell output 3d or 2d
@@ -96,6 +96,7 @@ def get_femnodes_by_references(femmesh, references):
 
 def get_femnodes_by_refshape(femmesh, ref):
     nodes = []
+    faces = []
     for refelement in ref[1]:
         r = sub_shape_at_global_placement(ref[0], refelement)
         FreeCAD.Console.PrintMessage(
@@ -110,7 +111,8 @@ def get_femnodes_by_refshape(femmesh, ref):
         elif r.ShapeType == "Edge":
             nodes += femmesh.getNodesByEdge(r)
         elif r.ShapeType == "Face":
-            nodes += femmesh.getNodesByFace(r)
+            # faces are searched together, see below
+            faces.append(r)
         elif r.ShapeType == "Solid":
             nodes += femmesh.getNodesBySolid(r)
         elif r.ShapeType == "Compound":
@@ -118,6 +120,9 @@ def get_femnodes_by_refshape(femmesh, ref):
                 nodes += femmesh.getNodesBySolid(s)
         else:
             FreeCAD.Console.PrintMessage("  No Vertice, Edge, Face or Solid as reference shapes!\n")
+    if faces:
+        for face_nodes in femmesh.getNodesByFaces(faces):
+            nodes += face_nodes
     return nodes
 
 
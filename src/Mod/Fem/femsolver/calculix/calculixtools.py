@@ -31,12 +31,10 @@ import os
 import shutil
 
 from vtkmodules.util import numpy_support as vtk_np
-from vtkmodules.vtkIOXML import vtkXMLMultiBlockDataReader
 from vtkmodules.vtkCommonDataModel import vtkMultiBlockDataSet
 import numpy as np
 
 import FreeCAD
-import Fem
 
 from . import writer
 from .. import settings
@@ -183,22 +181,13 @@ class CalculiXTools(ObjectTools):
             self.obj.Results = tmp
             create = True
 
-        frd_result_prefix = os.path.join(self.obj.WorkingDirectory, self.input_deck)
-        binary_mode = self.fem_param.GetGroup("Ccx").GetBool("BinaryOutput", False)
-        Fem.frdToVTK(frd_result_prefix + ".frd", binary_mode)
-        files = os.listdir(self.obj.WorkingDirectory)
-        for f in files:
-            if f.endswith(".vtm"):
-                vtm_file = os.path.join(self.obj.WorkingDirectory, f)
-                reader = vtkXMLMultiBlockDataReader()
-                reader.SetFileName(vtm_file)
-                reader.Update()
-                multi_block = reader.GetOutput()
-                multi_block = self._generate_derived_result(multi_block)
-                if self.obj.DisplaceMesh:
-                    multi_block = self._generate_disp_mesh(multi_block)
-                pipeline.Data = multi_block
-                break
+        # read the results straight into the pipeline, without intermediate vtk files
+        frd_file = os.path.join(self.obj.WorkingDirectory, self.input_deck + ".frd")
+        pipeline.read(frd_file)
+        multi_block = self._generate_derived_result(pipeline.Data)
+        if self.obj.DisplaceMesh:
+            multi_block = self._generate_disp_mesh(multi_block)
+        pipeline.Data = multi_block
 
         pipeline.renameArrays(self.frd_var_conversion(self.obj.AnalysisType))
         self._set_time_info(pipeline)
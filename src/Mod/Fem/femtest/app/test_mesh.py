@@ -668,3 +668,120 @@ class TestMeshGroups(unittest.TestCase):
             new_fm.getGroupElements(new_fm.Groups[0]),
             msg="Group elements not retained",
         )
+
+
+# ************************************************************************************************
+# ************************************************************************************************
+class TestMeshNodeSearch(unittest.TestCase):
+    fcc_print("import TestMeshNodeSearch")
+
+    # ********************************************************************************************
+    def setUp(self):
+        # setUp is executed before every test
+
+        # a box of 4 x 3 x 2 unit cubes, each split into six tetrahedra
+        import Part
+
+        self.box = Part.makeBox(4, 3, 2)
+        self.mesh = Fem.FemMesh()
+        size = (4, 3, 2)
+
+        def node_id(i, j, k):
+            return 1 + i + j * (size[0] + 1) + k * (size[0] + 1) * (size[1] + 1)
+
+        for k in range(size[2] + 1):
+            for j in range(size[1] + 1):
+                for i in range(size[0] + 1):
+                    self.mesh.addNode(i, j, k, node_id(i, j, k))
+
+        paths = [(0, 1, 2), (0, 2, 1), (1, 0, 2), (1, 2, 0), (2, 0, 1), (2, 1, 0)]
+        for k in range(size[2]):
+            for j in range(size[1]):
+                for i in range(size[0]):
+                    for path in paths:
+                        corner = [i, j, k]
+                        tetra = [node_id(*corner)]
+                        for axis in path:
+                            corner[axis] += 1
+                            tetra.append(node_id(*corner))
+                        self.mesh.addVolume(tetra)
+
+    # ********************************************************************************************
+    def test_00print(self):
+        # since method name starts with 00 this will be run first
+        # this test just prints a line with stars
+
+        fcc_print(
+            "\n{0}\n{1} run FEM TestMeshNodeSearch tests {2}\n{0}".format(
+                100 * "*", 10 * "*", 58 * "*"
+            )
+        )
+
+    # ********************************************************************************************
+    def scan_nodes(self, shape, tolerance):
+        # the nodes of the mesh checked one by one, without the node index
+        import Part
+
+        return sorted(
+            node
+            for node, pos in self.mesh.Nodes.items()
+            if shape.distToShape(Part.Vertex(pos))[0] < tolerance
+        )
+
+    # ********************************************************************************************
+    def test_nodes_by_face(self):
+        self.assertEqual(self.mesh.VolumeCount, 4 * 3 * 2 * 6)
+        for face in self.box.Faces:
+            self.assertEqual(
+                sorted(self.mesh.getNodesByFace(face)),
+                self.scan_nodes(face, face.Tolerance),
+            )
+
+    # ********************************************************************************************
+    def test_nodes_by_faces(self):
+        faces = self.box.Faces
+        result = self.mesh.getNodesByFaces(faces)
+        self.assertEqual(len(result), len(faces))
+        for face, nodes in zip(faces, result):
+            self.assertEqual(sorted(nodes), sorted(self.mesh.getNodesByFace(face)))
+            self.assertEqual(sorted(nodes), self.scan_nodes(face, face.Tolerance))
+
+    # ********************************************************************************************
+    def test_nodes_by_edge(self):
+        for edge in self.box.Edges:
+            self.assertEqual(
+                sorted(self.mesh.getNodesByEdge(edge)),
+                self.scan_nodes(edge, edge.Tolerance),
+            )
+
+    # ********************************************************************************************
+    def test_nodes_by_solid(self):
+        import Part
+
+        solid = Part.makeBox(2, 2, 2, FreeCAD.Vector(1, 0, 0))
+        nodes = sorted(self.mesh.getNodesBySolid(solid))
+        self.assertEqual(len(nodes), 3 * 3 * 3)
+        self.assertEqual(nodes, self.scan_nodes(solid, solid.getTolerance(1)))
+
+    # ********************************************************************************************
+    def test_nodes_after_transform(self):
+        face = self.box.Faces[0]
+        before = sorted(self.mesh.getNodesByFace(face))
+        self.assertEqual(len(before), 3 * 4)
+
+        # the searches after a move of the mesh must not use the old positions
+        self.mesh.setTransform(FreeCAD.Placement(FreeCAD.Vector(1, 0, 0), FreeCAD.Rotation()))
+        after = sorted(self.mesh.getNodesByFace(face))
+        self.assertNotEqual(before, after)
+        self.assertEqual(after, self.scan_nodes(face, face.Tolerance))
+
+    # ********************************************************************************************
+    def test_nodes_after_add_node(self):
+        face = self.box.Faces[0]
+        before = self.mesh.getNodesByFace(face)
+
+        # a new node on the face
+        self.mesh.addNode(0, 0.5, 0.5, 1000)
+        after = self.mesh.getNodesByFace(face)
+        self.assertEqual(sorted(after), sorted(before + [1000]))
+        self.assertEqual(sorted(after), self.scan_nodes(face, face.Tolerance))
@@ -179,6 +179,26 @@ class TestResult(unittest.TestCase):
             # fcc_print("Case{}: {}".format(i + 1 , rhores))
             self.assertEqual(rhores, case[1], f"Calculated rho are not the expected Case{i + 1}.")
 
+    # ********************************************************************************************
+    def test_read_frd_into_pipeline(self):
+        if "BUILD_FEM_VTK_PYTHON" not in FreeCAD.__cmake__:
+            self.skipTest("VTK python wrapper not available")
+        frd_file = join(testtools.get_fem_test_home_dir(), "calculix", "box_static.frd")
+        pipeline = self.document.addObject("Fem::FemPostPipeline", "Pipeline")
+        pipeline.read(frd_file)
+
+        # the static analysis has a single frame
+        data = pipeline.Data
+        self.assertEqual(data.GetNumberOfBlocks(), 1)
+        grid = data.GetBlock(0)
+        self.assertEqual(grid.GetNumberOfPoints(), 280)
+        self.assertEqual(grid.GetNumberOfCells(), 129)
+        point_data = grid.GetPointData()
+        for name in ("DISP", "STRESS", "TOSTRAIN"):
+            self.assertIsNotNone(point_data.GetArray(name), f"Result array {name} is missing.")
+        self.assertEqual(point_data.GetArray("DISP").GetNumberOfComponents(), 3)
+        self.assertEqual(point_data.GetArray("STRESS").GetNumberOfComponents(), 6)
+
     # ********************************************************************************************
     def test_disp_abs(self):
         expected_dispabs = 87.302986
@@ -26,13 +26,13 @@
 # define WNT  // avoid conflict with GUID
 #endif
 #include <Interface_Static.hxx>
+#include <OSD_Parallel.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
 #include <TDF_AttributeSequence.hxx>
 #include <TDF_Label.hxx>
 #include <TDF_LabelSequence.hxx>
-#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
@@ -51,6 +51,7 @@
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
+#include <Base/TimeInfo.h>
 #include <Mod/Part/App/FeatureCompound.h>
 #include <Mod/Part/App/Interface.h>
 #include <Mod/Part/App/OCAF/ImportExportSettings.h>
@@ -198,7 +199,7 @@ void ImportOCAF2::setObjectName(Info& info, TDF_Label label)
     }
 }
 
-bool ImportOCAF2::getColor(const TopoDS_Shape& shape, Info& info, bool check, bool noDefault)
+bool ImportOCAF2::getColor(const TopoDS_Shape& shape, Info& info, bool check, bool noDefault) const
 {
     bool ret = false;
     Quantity_ColorRGBA aColor;
@@ -278,95 +279,119 @@ App::DocumentObject* ImportOCAF2::expandShape(App::Document* doc, TDF_Label labe
     return info.obj;
 }
 
-bool ImportOCAF2::createObject(
-    App::Document* doc,
-    TDF_Label label,
-    const TopoDS_Shape& shape,
-    Info& info,
-    bool newDoc
-)
+/*!
+ * Gather the colors of a part and of its colored sub-shapes.
+ * This only reads the OCAF document and builds the sub-shape index of the
+ * returned TopoShape, which the feature reuses for its element names. It does
+ * not touch the FreeCAD document, so prepareShapes() runs it for all parts on
+ * worker threads.
+ */
+ImportOCAF2::PartData ImportOCAF2::preparePart(TDF_Label label, const TopoDS_Shape& shape) const
 {
-    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
-        FC_WARN(Tools::labelName(label) << " has empty shape");
-        return false;
-    }
-
+    PartData data;
+    data.shape = Part::TopoShape(shape);
+    Info& info = data.info;
     getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
-
-    Part::TopoShape tshape(shape);
-    std::vector<Base::Color> faceColors;
-    std::vector<Base::Color> edgeColors;
 
     TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
-
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
-
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for (int j = 0; j < 2; ++j) {
-            for (int i = 1; i <= seq.Length(); ++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if (subShape.IsNull()) {
-                    continue;
-                }
-                if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
-                    if (j == 0) {
-                        continue;
-                    }
-                }
-                else if (j != 0) {
+    if (label.IsNull() || !aShapeTool->GetSubShapes(label, seq)) {
+        return data;
+    }
+
+    const Part::TopoShape& tshape = data.shape;
+    data.faceColors.assign(tshape.getSubShapes(TopAbs_FACE).size(), info.faceColor);
+    data.edgeColors.assign(tshape.getSubShapes(TopAbs_EDGE).size(), info.edgeColor);
+    auto& faceColors = data.faceColors;
+    auto& edgeColors = data.edgeColors;
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 1; i <= seq.Length(); ++i) {
+            TDF_Label l = seq.Value(i);
+            TopoDS_Shape subShape = aShapeTool->GetShape(l);
+            if (subShape.IsNull()) {
+                continue;
+            }
+            if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
+                if (j == 0) {
                     continue;
                 }
+            }
+            else if (j != 0) {
+                continue;
+            }
 
-                bool foundFaceColor = false, foundEdgeColor = false;
-                Base::Color faceColor, edgeColor;
-                Quantity_ColorRGBA aColor;
-                if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
-                    || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
-                    faceColor = Tools::convertColor(aColor);
-                    foundFaceColor = true;
-                }
-                if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = Tools::convertColor(aColor);
-                    foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
-                        // Do not set edge the same color as face
-                        foundEdgeColor = false;
-                    }
+            bool foundFaceColor = false, foundEdgeColor = false;
+            Base::Color faceColor, edgeColor;
+            Quantity_ColorRGBA aColor;
+            if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
+                || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
+                faceColor = Tools::convertColor(aColor);
+                foundFaceColor = true;
+            }
+            if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+                edgeColor = Tools::convertColor(aColor);
+                foundEdgeColor = true;
+                if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
+                    // Do not set edge the same color as face
+                    foundEdgeColor = false;
                 }
+            }
 
-                if (foundFaceColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
-                        int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
+            if (foundFaceColor) {
+                for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
+                    int idx = tshape.findShape(exp.Current()) - 1;
+                    if (idx >= 0 && idx < (int)faceColors.size()) {
+                        faceColors[idx] = faceColor;
+                        data.hasFaceColors = true;
+                        info.hasFaceColor = true;
                     }
                 }
-                if (foundEdgeColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
-                        int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
+            }
+            if (foundEdgeColor) {
+                for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
+                    int idx = tshape.findShape(exp.Current()) - 1;
+                    if (idx >= 0 && idx < (int)edgeColors.size()) {
+                        edgeColors[idx] = edgeColor;
+                        data.hasEdgeColors = true;
+                        info.hasEdgeColor = true;
                     }
                 }
             }
         }
     }
+    return data;
+}
+
+bool ImportOCAF2::createObject(
+    App::Document* doc,
+    TDF_Label label,
+    const TopoDS_Shape& shape,
+    Info& info,
+    bool newDoc
+)
+{
+    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
+        FC_WARN(Tools::labelName(label) << " has empty shape");
+        return false;
+    }
+
+    PartData data;
+    auto itPart = myParts.find(shape);
+    if (itPart != myParts.end()) {
+        data = std::move(itPart->second);
+        myParts.erase(itPart);
+    }
+    else {
+        data = preparePart(label, shape);
+    }
+    // keep what the caller already set, e.g. Info::free
+    info.faceColor = data.info.faceColor;
+    info.edgeColor = data.info.edgeColor;
+    info.hasFaceColor = data.info.hasFaceColor;
+    info.hasEdgeColor = data.info.hasEdgeColor;
+    const Part::TopoShape& tshape = data.shape;
 
     Part::Feature* feature;
 
@@ -382,15 +407,16 @@ bool ImportOCAF2::createObject(
     }
     else {
         feature = doc->addObject<Part::Feature>(tshape.shapeName().c_str());
-        feature->Shape.setValue(shape);
+        // the prepared sub-shape index is passed on with the shape
+        feature->Shape.setValue(tshape);
     }
     applyFaceColors(feature, {info.faceColor});
     applyEdgeColors(feature, {info.edgeColor});
-    if (hasFaceColors) {
-        applyFaceColors(feature, faceColors);
+    if (data.hasFaceColors) {
+        applyFaceColors(feature, data.faceColors);
     }
-    if (hasEdgeColors) {
-        applyEdgeColors(feature, edgeColors);
+    if (data.hasEdgeColors) {
+        applyEdgeColors(feature, data.edgeColors);
     }
 
     info.propPlacement = &feature->Placement;
@@ -522,11 +548,20 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     FC_LOG("free shape count " << labels.Length());
     sequencer = options.showProgress ? &seq : nullptr;
 
+    Base::TimeElapsed prepareStart;
+    prepareShapes(labels);
+    FC_LOG(
+        "prepared " << myParts.size() << " parts in " << Base::TimeElapsed::diffTimeF(prepareStart)
+                    << " s"
+    );
+
     labels.Clear();
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
 
+    Base::TimeElapsed createStart;
+
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
     boost::dynamic_bitset<> vis;
@@ -562,6 +597,11 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     if (ret) {
         ret->recomputeFeature(true);
     }
+    FC_LOG("created objects in " << Base::TimeElapsed::diffTimeF(createStart) << " s");
+    // parts that were not reached, e.g. hidden ones, are no longer needed
+    myParts.clear();
+    mySHUOColors.clear();
+
     if (options.merge && ret && !ret->isDerivedFrom<Part::Feature>()) {
         auto shape = Part::Feature::getTopoShape(
             ret,
@@ -589,13 +629,18 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     return ret;
 }
 
-void ImportOCAF2::getSHUOColors(TDF_Label label, std::map<std::string, Base::Color>& colors, bool appendFirst)
+/*!
+ * Collect the colored or hidden sub-assembly usages of the component \a label.
+ * Only the OCAF document is read, the object names are resolved later in
+ * getSHUOColors(), once the objects exist.
+ */
+std::vector<ImportOCAF2::SHUOColor> ImportOCAF2::collectSHUOColors(TDF_Label label) const
 {
+    std::vector<SHUOColor> result;
     TDF_AttributeSequence seq;
     if (label.IsNull() || !aShapeTool->GetAllComponentSHUO(label, seq)) {
-        return;
+        return result;
     }
-    std::ostringstream ss;
     for (int i = 1; i <= seq.Length(); ++i) {
         Handle(XCAFDoc_GraphNode) shuo = Handle(XCAFDoc_GraphNode)::DownCast(seq.Value(i));
         if (shuo.IsNull()) {
@@ -611,44 +656,128 @@ void ImportOCAF2::getSHUOColors(TDF_Label label, std::map<std::string, Base::Col
             continue;
         }
 
-        // appendFirst tells us whether we shall append the object name of the first label
-        bool skipFirst = !appendFirst;
-        ss.str("");
-        while (true) {
-            if (skipFirst) {
-                skipFirst = false;
-            }
-            else {
-                TDF_Label l = shuo->Label().Father();
-                auto it = myNames.find(l);
-                if (it == myNames.end()) {
-                    FC_WARN("Failed to find object of label " << Tools::labelName(l));
-                    ss.str("");
-                    break;
-                }
-                if (!it->second.empty()) {
-                    ss << it->second << '.';
-                }
+        SHUOColor entry;
+        if (!aColorTool->IsVisible(slabel)) {
+            entry.hidden = true;
+        }
+        else {
+            Quantity_ColorRGBA aColor;
+            if (aColorTool->GetColor(slabel, XCAFDoc_ColorSurf, aColor)
+                || aColorTool->GetColor(slabel, XCAFDoc_ColorGen, aColor)) {
+                entry.color = Tools::convertColor(aColor);
+                entry.hasColor = true;
             }
+        }
+        if (!entry.hidden && !entry.hasColor) {
+            continue;
+        }
+
+        while (true) {
+            entry.path.push_back(shuo->Label().Father());
             if (!shuo->NbChildren()) {
                 break;
             }
             shuo = shuo->GetChild(1);
         }
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+void ImportOCAF2::getSHUOColors(TDF_Label label, std::map<std::string, Base::Color>& colors, bool appendFirst)
+{
+    if (label.IsNull()) {
+        return;
+    }
+    auto itPrepared = mySHUOColors.find(label);
+    std::vector<SHUOColor> collected;
+    if (itPrepared == mySHUOColors.end()) {
+        collected = collectSHUOColors(label);
+    }
+    const auto& entries = itPrepared != mySHUOColors.end() ? itPrepared->second : collected;
+
+    std::ostringstream ss;
+    for (const auto& entry : entries) {
+        ss.str("");
+        // appendFirst tells us whether we shall append the object name of the first label
+        for (std::size_t i = appendFirst ? 0 : 1; i < entry.path.size(); ++i) {
+            auto it = myNames.find(entry.path[i]);
+            if (it == myNames.end()) {
+                FC_WARN("Failed to find object of label " << Tools::labelName(entry.path[i]));
+                ss.str("");
+                break;
+            }
+            if (!it->second.empty()) {
+                ss << it->second << '.';
+            }
+        }
         std::string subname = ss.str();
         if (subname.empty()) {
             continue;
         }
-        if (!aColorTool->IsVisible(slabel)) {
+        if (entry.hidden) {
             subname += App::DocumentObject::hiddenMarker();
             colors.emplace(subname, Base::Color());
         }
         else {
-            Quantity_ColorRGBA aColor;
-            if (aColorTool->GetColor(slabel, XCAFDoc_ColorSurf, aColor)
-                || aColorTool->GetColor(slabel, XCAFDoc_ColorGen, aColor)) {
-                colors.emplace(subname, Tools::convertColor(aColor));
+            colors.emplace(subname, entry.color);
+        }
+    }
+}
+
+/*!
+ * Gather the colors and sub-shape indices of all parts and the SHUO colors of
+ * all components on worker threads. The document objects are created one by
+ * one afterwards through loadShape(), and createObject() takes the prepared
+ * data from here.
+ */
+void ImportOCAF2::prepareShapes(const TDF_LabelSequence& labels)
+{
+    myParts.clear();
+    mySHUOColors.clear();
+
+    // The shape tool of the color tool is set up on first use
+    aColorTool->ShapeTool();
+
+    std::vector<std::pair<TDF_Label, TopoDS_Shape>> parts;
+    std::vector<TDF_Label> components;
+    std::unordered_map<TopoDS_Shape, bool, ShapeHasher> seen;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        auto label = labels.Value(i);
+        if (aShapeTool->IsAssembly(label)) {
+            TDF_LabelSequence comps;
+            aShapeTool->GetComponents(label, comps);
+            for (Standard_Integer j = 1; j <= comps.Length(); j++) {
+                components.push_back(comps.Value(j));
             }
+            continue;
+        }
+        auto shape = aShapeTool->GetShape(label).Located(TopLoc_Location());
+        if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()
+            || !seen.emplace(shape, true).second) {
+            continue;
+        }
+        parts.emplace_back(aShapeTool->FindShape(shape), shape);
+    }
+
+    std::vector<PartData> partData(parts.size());
+    std::vector<std::vector<SHUOColor>> shuoColors(components.size());
+    int partCount = static_cast<int>(parts.size());
+    OSD_Parallel::For(0, partCount + static_cast<int>(components.size()), [&](int i) {
+        if (i < partCount) {
+            partData[i] = preparePart(parts[i].first, parts[i].second);
+        }
+        else {
+            shuoColors[i - partCount] = collectSHUOColors(components[i - partCount]);
+        }
+    });
+
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        myParts.emplace(parts[i].second, std::move(partData[i]));
+    }
+    for (std::size_t i = 0; i < components.size(); ++i) {
+        if (!shuoColors[i].empty()) {
+            mySHUOColors.emplace(components[i], std::move(shuoColors[i]));
         }
     }
 }
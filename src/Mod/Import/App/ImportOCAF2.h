@@ -30,6 +30,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <TDF_LabelSequence.hxx>
 #include <TDocStd_Document.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XCAFDoc_ColorTool.hxx>
@@ -171,8 +172,32 @@ private:
         const boost::dynamic_bitset<>& visibilities,
         bool canReduce = false
     );
-    bool getColor(const TopoDS_Shape& shape, Info& info, bool check = false, bool noDefault = false);
+    bool getColor(const TopoDS_Shape& shape, Info& info, bool check = false, bool noDefault = false)
+        const;
     void getSHUOColors(TDF_Label label, std::map<std::string, Base::Color>& colors, bool appendFirst);
+
+    /// Colors and sub-shape index of a part, gathered before its object is created
+    struct PartData
+    {
+        Part::TopoShape shape;
+        Info info;
+        std::vector<Base::Color> faceColors;
+        std::vector<Base::Color> edgeColors;
+        bool hasFaceColors = false;
+        bool hasEdgeColors = false;
+    };
+    /// A colored or hidden sub-assembly usage (SHUO) of a component
+    struct SHUOColor
+    {
+        /// labels of the components along the usage path, the first one is the component itself
+        std::vector<TDF_Label> path;
+        bool hidden = false;
+        bool hasColor = false;
+        Base::Color color;
+    };
+    PartData preparePart(TDF_Label label, const TopoDS_Shape& shape) const;
+    std::vector<SHUOColor> collectSHUOColors(TDF_Label label) const;
+    void prepareShapes(const TDF_LabelSequence& labels);
     void setObjectName(Info& info, TDF_Label label);
     std::string getLabelName(TDF_Label label);
     App::DocumentObject* expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape& shape);
@@ -217,6 +242,9 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    /// Parts prepared by prepareShapes(), an entry is consumed when its object is created
+    std::unordered_map<TopoDS_Shape, PartData, ShapeHasher> myParts;
+    std::unordered_map<TDF_Label, std::vector<SHUOColor>, LabelHasher> mySHUOColors;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
@@ -23,14 +23,31 @@
 
 
 #include <boost/core/ignore_unused.hpp>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <gp.hxx>
+#include <Precision.hxx>
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <TDF_LabelSequence.hxx>
 #include <Message_ProgressRange.hxx>
 #include <RWGltf_CafWriter.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
 
 #include "WriterGltf.h"
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/encodeFilename.h>
+#include <Mod/Part/App/Tools.h>
 
 using namespace Import;
 
@@ -38,8 +55,105 @@ WriterGltf::WriterGltf(const Base::FileInfo& file)  // NOLINT
     : file {file}
 {}
 
+namespace
+{
+// The shapes of the export document share their faces with the FreeCAD
+// document, so the triangulations added for the export are removed again
+class TriangulationCleaner
+{
+public:
+    explicit TriangulationCleaner(const TopoDS_Shape& shape)
+        : shape {shape}
+    {}
+    ~TriangulationCleaner()
+    {
+        try {
+            BRepTools::Clean(shape);
+        }
+        catch (const Standard_Failure&) {
+        }
+    }
+    TriangulationCleaner(const TriangulationCleaner&) = delete;
+    TriangulationCleaner& operator=(const TriangulationCleaner&) = delete;
+
+private:
+    TopoDS_Shape shape;
+};
+}  // namespace
+
+TopoDS_Shape WriterGltf::meshShapes(Handle(TDocStd_Document) hDoc) const  // NOLINT
+{
+    // The writer only exports existing triangulations, so without the GUI the
+    // shapes would be written without any geometry. Use the same tessellation
+    // settings as the 3D view and mesh every face only once, even if its part
+    // is instanced many times. The faces of a part are meshed in parallel.
+    // Faces that already have a triangulation are left untouched, the others
+    // are returned so that their triangulation can be removed afterwards.
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);  // NOLINT
+    double angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);  // NOLINT
+
+    Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    TDF_LabelSequence labels;
+    shapeTool->GetShapes(labels);
+
+    TopTools_MapOfShape meshedFaces;
+    BRep_Builder builder;
+    TopoDS_Compound newlyMeshed;
+    builder.MakeCompound(newlyMeshed);
+    for (const TDF_Label& label : labels) {
+        // The parts of an assembly are listed separately
+        if (XCAFDoc_ShapeTool::IsAssembly(label)) {
+            continue;
+        }
+
+        TopoDS_Shape shape = XCAFDoc_ShapeTool::GetShape(label);
+        if (shape.IsNull()) {
+            continue;
+        }
+
+        TopoDS_Compound faces;
+        builder.MakeCompound(faces);
+        bool hasFaces = false;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            const TopoDS_Face& face = TopoDS::Face(xp.Current());
+            TopLoc_Location loc;
+            if (!meshedFaces.Add(face.Located(TopLoc_Location()))
+                || !BRep_Tool::Triangulation(face, loc).IsNull()) {
+                continue;
+            }
+            builder.Add(faces, face);
+            hasFaces = true;
+        }
+
+        if (!hasFaces) {
+            continue;
+        }
+
+        Standard_Real deflection = Part::Tools::getDeflection(shape, deviation);
+        if (deflection < gp::Resolution()) {
+            deflection = Precision::Confusion();
+        }
+
+        IMeshTools_Parameters meshParams;
+        meshParams.Deflection = deflection;
+        meshParams.Relative = Standard_False;
+        meshParams.Angle = Base::toRadians(angularDeflection);
+        meshParams.InParallel = Standard_True;
+        meshParams.AllowQualityDecrease = Standard_True;
+        BRepMesh_IncrementalMesh(faces, meshParams);
+        builder.Add(newlyMeshed, faces);
+    }
+
+    return newlyMeshed;
+}
+
 void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 {
+    TriangulationCleaner cleaner(meshShapes(hDoc));
+
     std::string utf8Name = file.filePath();
     std::string name8bit = Part::encodeFilename(utf8Name);
 
@@ -49,6 +163,10 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
     // https://github.com/KhronosGroup/glTF/blob/master/specification/2.0/README.md#coordinate-system-and-units
     aWriter.ChangeCoordinateSystemConverter().SetInputLengthUnit(0.001);  // NOLINT
     aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem(RWMesh_CoordinateSystem_Zup);
+#if OCC_VERSION_HEX >= 0x070600
+    // Write one primitive per part and style instead of one per face
+    aWriter.SetMergeFaces(true);
+#endif
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
 #endif
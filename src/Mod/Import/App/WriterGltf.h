@@ -26,6 +26,7 @@
 #include <Mod/Import/ImportGlobal.h>
 #include <Base/FileInfo.h>
 #include <TDocStd_Document.hxx>
+#include <TopoDS_Shape.hxx>
 
 namespace Import
 {
@@ -37,6 +38,10 @@ public:
 
     void write(Handle(TDocStd_Document) hDoc) const;
 
+private:
+    /// Tessellate the faces that have no triangulation yet and return them
+    TopoDS_Shape meshShapes(Handle(TDocStd_Document) hDoc) const;
+
 private:
     Base::FileInfo file;
 };
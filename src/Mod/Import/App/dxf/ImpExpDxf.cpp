@@ -44,6 +44,8 @@
 #include <Geom_Ellipse.hxx>
 #include <Geom_Line.hxx>
 #include <Geom_BSplineCurve.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_Failure.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -63,6 +65,7 @@
 #include <Precision.hxx>
 #include <gp_Vec.hxx>
 
+#include <atomic>
 #include <fstream>
 #include <App/Annotation.h>
 #include <App/Application.h>
@@ -477,6 +480,7 @@ bool ImpExpDxfRead::ReadEntitiesSection()
             if (!CDxfRead::ReadEntitiesSection()) {
                 return false;
             }
+            savingCollector.BuildShapes();
         }
 
         // Merge the contents of ShapesToCombine and AddObject the result(s)
@@ -503,6 +507,25 @@ bool ImpExpDxfRead::ReadEntitiesSection()
     return true;
 }
 
+void ImpExpDxfRead::ShapeSavingEntityCollector::BuildShapes()
+{
+    std::atomic<int> failed {0};
+    OSD_Parallel::For(0, static_cast<int>(PendingShapes.size()), [this, &failed](int i) {
+        auto& [slot, build] = PendingShapes[i];
+        try {
+            *slot = build();
+        }
+        catch (const Standard_Failure&) {
+            // The slot stays empty, CombineShapes() skips empty shapes
+            ++failed;
+        }
+    });
+    PendingShapes.clear();
+    if (failed > 0) {
+        Reader.ImportError("%d entities could not be converted to shapes\n", failed.load());
+    }
+}
+
 void ImpExpDxfRead::CombineShapes(std::list<TopoDS_Shape>& shapes, const char* nameBase) const
 {
     BRep_Builder builder;
@@ -955,6 +978,14 @@ void ImpExpDxfRead::OnReadLine(const Base::Vector3d& start, const Base::Vector3d
     if (p0.IsEqual(p1, 1e-8)) {
         return;
     }
+    if (m_importMode == ImportMode::FusedShapes) {
+        // The shape is built later, concurrently with the other shapes of the drawing
+        Collector->AddShapeBuilder(
+            [p0, p1]() -> TopoDS_Shape { return BRepBuilderAPI_MakeEdge(p0, p1).Edge(); },
+            "Line"
+        );
+        return;
+    }
     TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(p0, p1).Edge();
     GeometryBuilder builder(edge);
 
@@ -1023,6 +1054,16 @@ void ImpExpDxfRead::OnReadArc(
         Base::Console().warning("ImpExpDxf - ignore degenerate arc of circle\n");
         return;
     }
+    if (m_importMode == ImportMode::FusedShapes) {
+        // The shape is built later, concurrently with the other shapes of the drawing
+        Collector->AddShapeBuilder(
+            [circle, p0, p1]() -> TopoDS_Shape {
+                return BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge();
+            },
+            "Arc"
+        );
+        return;
+    }
 
     TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge();
     GeometryBuilder builder(edge);  // Instantiate builder once
@@ -1058,6 +1099,14 @@ void ImpExpDxfRead::OnReadCircle(const Base::Vector3d& start, const Base::Vector
         Base::Console().warning("ImpExpDxf - ignore degenerate circle\n");
         return;
     }
+    if (m_importMode == ImportMode::FusedShapes) {
+        // The shape is built later, concurrently with the other shapes of the drawing
+        Collector->AddShapeBuilder(
+            [circle]() -> TopoDS_Shape { return BRepBuilderAPI_MakeEdge(circle).Edge(); },
+            "Circle"
+        );
+        return;
+    }
 
     TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(circle).Edge();
     GeometryBuilder builder(edge);  // Instantiate builder once
@@ -1176,6 +1225,28 @@ void ImpExpDxfRead::OnReadSpline(struct SplineData& sd)
         return;
     }
 
+    if (m_importMode == ImportMode::FusedShapes) {
+        // The shape is built later, concurrently with the other shapes of the drawing. Fitting
+        // or checking the knots of a spline is the costly part, so it is deferred as well.
+        Collector->AddShapeBuilder(
+            [sd]() mutable -> TopoDS_Shape {
+                Handle(Geom_BSplineCurve) geom;
+                if (sd.control_points > 0) {
+                    geom = getSplineFromPolesAndKnots(sd);
+                }
+                else if (sd.fit_points > 0) {
+                    geom = getInterpolationSpline(sd);
+                }
+                if (geom.IsNull()) {
+                    return {};
+                }
+                return BRepBuilderAPI_MakeEdge(geom).Edge();
+            },
+            "Spline"
+        );
+        return;
+    }
+
     try {
         Handle(Geom_BSplineCurve) geom;
         if (sd.control_points > 0) {
@@ -1373,6 +1444,17 @@ void ImpExpDxfRead::OnReadPolyline(std::list<VertexInfo>& vertices, int flags)
         return;  // Not enough vertices for an open polyline
     }
 
+    if (m_importMode == ImportMode::FusedShapes) {
+        // The shape is built later, concurrently with the other shapes of the drawing
+        Collector->AddShapeBuilder(
+            [this, vertices, flags]() mutable -> TopoDS_Shape {
+                return BuildWireFromPolyline(vertices, flags);
+            },
+            "Polyline"
+        );
+        return;
+    }
+
     TopoDS_Wire wire = BuildWireFromPolyline(vertices, flags);
     if (wire.IsNull()) {
         return;
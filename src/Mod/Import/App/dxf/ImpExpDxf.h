@@ -24,8 +24,10 @@
 
 #pragma once
 
+#include <functional>
 #include <set>
 #include <gp_Pnt.hxx>
+#include <Standard_Failure.hxx>
 
 #include <App/Document.h>
 #include <App/Link.h>
@@ -303,6 +305,23 @@ protected:
         virtual void AddGeometry(const GeometryBuilder& builder) = 0;
         // Called by OnReadInsert to add App::Link or other C++-created objects
         virtual void AddObject(App::DocumentObject* obj, const char* nameBase) = 0;
+        // Called by OnReadXxxx functions in the fused shapes mode. The shape is only built when
+        // needed, so that collectors which combine many shapes can build them concurrently.
+        using ShapeBuilder = std::function<TopoDS_Shape()>;
+        virtual void AddShapeBuilder(const ShapeBuilder& build, const char* nameBase)
+        {
+            TopoDS_Shape shape;
+            try {
+                shape = build();
+            }
+            catch (const Standard_Failure&) {
+                Reader.ImportError("%s could not be converted to a shape\n", nameBase);
+                return;
+            }
+            if (!shape.IsNull()) {
+                AddObject(shape, nameBase);
+            }
+        }
         // Called by OnReadXxxx functions to add FeaturePython (draft) objects.
         // Because we can't readily copy Draft objects, this method instead takes a builder which,
         // when called, creates and returns the object.
@@ -410,8 +429,19 @@ protected:
             DrawingEntityCollector::AddObject(obj, nameBase);
         }
 
+        void AddShapeBuilder(const ShapeBuilder& build, const char* /*nameBase*/) override
+        {
+            // Keep the place of the shape in the list, it is built in BuildShapes()
+            auto& shapes = ShapesList[Reader.m_entityAttributes];
+            PendingShapes.emplace_back(shapes.insert(shapes.end(), TopoDS_Shape()), build);
+        }
+
+        // Build the pending shapes concurrently
+        void BuildShapes();
+
     private:
         std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>>& ShapesList;
+        std::vector<std::pair<std::list<TopoDS_Shape>::iterator, ShapeBuilder>> PendingShapes;
     };
 #ifdef LATER
     class PolylineEntityCollector: public CombiningDrawingEntityCollector
@@ -6,6 +6,7 @@
 // modified 2018 wandererfan
 
 
+#include <charconv>
 #include <cmath>
 #include <fstream>
 #include <iomanip>
@@ -1880,19 +1881,35 @@ void CDxfWrite::writeObjectsSection()
 const DxfUnits DxfUnits::Instance;
 
 CDxfRead::CDxfRead(const std::string& filepath)
-    : m_ifs(new ifstream(filepath))
 {
-    if (!(*m_ifs)) {
+    // Reading the file at once and splitting the lines in memory is much faster than reading
+    // the file line by line
+    ifstream ifs(filepath, std::ios::in | std::ios::binary);
+    if (!ifs) {
         m_fail = true;
         ImportError("DXF file didn't load\n");
         return;
     }
-    m_ifs->imbue(std::locale("C"));
+    ifs.seekg(0, std::ios::end);
+    std::streamoff size = ifs.tellg();
+    if (size < 0) {
+        m_fail = true;
+        ImportError("DXF file size could not be determined\n");
+        return;
+    }
+    m_buffer.resize(static_cast<std::size_t>(size));
+    ifs.seekg(0, std::ios::beg);
+    ifs.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    if (!ifs) {
+        m_fail = true;
+        ImportError("DXF file could not be read\n");
+        return;
+    }
+    m_valueStream.imbue(std::locale::classic());
 }
 
 CDxfRead::~CDxfRead()
 {
-    delete m_ifs;
     // Delete the Layer objects which are referenced by pointer from the Layers table.
     for (auto& pair : Layers) {
         delete pair.second;
@@ -1954,9 +1971,8 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 // Static processing helpers for ProcessCommonEntityAttribute
 void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
+    std::istringstream& ss = object->m_valueStream;
+    ss.clear();
     ss.str(object->m_record_data);
     double value = 0;
     ss >> value;
@@ -1970,9 +1986,8 @@ void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
+    std::istringstream& ss = object->m_valueStream;
+    ss.clear();
     ss.str(object->m_record_data);
     double value = 0;
     ss >> value;
@@ -1987,9 +2002,8 @@ void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
+    std::istringstream& ss = object->m_valueStream;
+    ss.clear();
     ss.str(object->m_record_data);
     ss >> *static_cast<T*>(target);
     if (ss.fail()) {
@@ -2444,6 +2458,21 @@ void CDxfRead::UnsupportedFeature(const char* format, args&&... argValuess)
     );
 }
 
+bool CDxfRead::get_next_line(std::string& line)
+{
+    if (m_bufferPos >= m_buffer.size()) {
+        return false;
+    }
+    std::size_t end = m_buffer.find('\n', m_bufferPos);
+    if (end == std::string::npos) {
+        end = m_buffer.size();
+    }
+    line.assign(m_buffer, m_bufferPos, end - m_bufferPos);
+    m_bufferPos = end + 1;
+    ++m_line;
+    return true;
+}
+
 bool CDxfRead::get_next_record()
 {
     if (m_repeat_last_record) {
@@ -2452,15 +2481,23 @@ bool CDxfRead::get_next_record()
     }
 
     do {
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(m_record_data)) {
             m_not_eof = false;
             return false;
         }
 
-        std::getline(*m_ifs, m_record_data);
-        ++m_line;
+        // The group code is right-justified, parse it without going through a stream
+        const char* first = m_record_data.data();
+        const char* last = first + m_record_data.size();
+        while (first != last && (*first == ' ' || *first == '\t')) {
+            ++first;
+        }
+        // std::from_chars does not accept the plus sign that a stream would have skipped
+        if (first != last && *first == '+') {
+            ++first;
+        }
         int temp = 0;
-        if (!ParseValue<int>(this, &temp)) {
+        if (std::from_chars(first, last, temp).ec != std::errc {}) {
             ImportError(
                 "CDxfRead::get_next_record() Failed to get integer record type from '%s'\n",
                 m_record_data
@@ -2468,12 +2505,10 @@ bool CDxfRead::get_next_record()
             return false;
         }
         m_record_type = (eDXFGroupCode_t)temp;
-        if ((*m_ifs).eof()) {
+
+        if (!get_next_line(m_record_data)) {
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
-        ++m_line;
     } while (m_record_type == eComment);
 
     // Remove any carriage return at the end of m_str which may occur because of inconsistent
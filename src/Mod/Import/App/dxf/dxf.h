@@ -19,6 +19,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -486,7 +487,11 @@ class ImportExport CDxfRead
 {
 private:
     // Low-level reader members
-    std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    // The whole file is read at once and the records are parsed from memory
+    std::string m_buffer;
+    std::size_t m_bufferPos = 0;
+    // Reused for parsing the values of the records
+    std::istringstream m_valueStream;
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -721,6 +726,7 @@ private:
     bool ReadBlockInfo();
     bool ResolveEncoding();
 
+    bool get_next_line(std::string& line);
     bool get_next_record();
     void repeat_last_record();
 
@@ -23,6 +23,9 @@
  ***************************************************************************/
 
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <numeric>
 #include <limits>
 
@@ -31,9 +34,11 @@
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp_Face.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <gp_Pnt.hxx>
 
+#include <QCoreApplication>
 #include <QEventLoop>
 #include <QFuture>
 #include <QFutureWatcher>
@@ -49,6 +54,7 @@
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsGrid.h>
 
@@ -473,39 +479,134 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
+namespace
+{
+// The distance query of a worker thread and the shape it has been loaded for
+struct DistanceQuery
+{
+    std::uint64_t shapeId {0};
+    std::unique_ptr<BRepExtrema_DistShapeShape> distss;
+};
+
+std::atomic<std::uint64_t> nextShapeId {1};
+}  // namespace
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float radius)
     : _rShape(shape)
+    , radius(radius)
+    , ownerThread(std::this_thread::get_id())
+    , shapeId(nextShapeId++)
 {
+    TopoDS_Shape distShape = getDistanceShape();
+    isSolid = !_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID
+        && distShape.ShapeType() == TopAbs_SHELL;
     distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
+    distss->LoadS1(distShape);
+    // distss->SetDeflection(radius);
+
+    tessellate();
+}
+
+InspectNominalShape::~InspectNominalShape()
+{
+    delete distss;
+}
+
+void InspectNominalShape::tessellate()
+{
+    if (_rShape.IsNull()) {
+        return;
+    }
+
+    // The tessellation only covers the faces, so the distance to edges or
+    // vertices that don't belong to a face would be missed
+    if (TopExp_Explorer(_rShape, TopAbs_EDGE, TopAbs_FACE).More()
+        || TopExp_Explorer(_rShape, TopAbs_VERTEX, TopAbs_EDGE).More()) {
+        return;
+    }
+
+    // Use the same tessellation as the 3D view with the default deviation
+    double deflection = Part::Tools::getDeflection(_rShape, 0.2);  // NOLINT
+    std::vector<Base::Vector3d> points;
+    std::vector<Data::ComplexGeoData::Facet> facets;
+    Part::TopoShape(_rShape).getFaces(points, facets, deflection);
+    if (facets.empty()) {
+        return;
+    }
+
+    std::vector<MeshCore::MeshGeomFacet> geomFacets;
+    geomFacets.reserve(facets.size());
+    for (const auto& it : facets) {
+        geomFacets.emplace_back(
+            Base::toVector<float>(points[it.I1]),
+            Base::toVector<float>(points[it.I2]),
+            Base::toVector<float>(points[it.I3])
+        );
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel = geomFacets;
+
+    // The tessellation deviates by up to the deflection from the surface, the
+    // nearest facet search of the grid is not exact either.
+    margin = 2.0F * static_cast<float>(deflection);
+    approxMesh = std::make_unique<Mesh::MeshObject>(kernel);
+    approx = std::make_unique<InspectNominalMesh>(*approxMesh, radius + margin);
+}
+
+float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+{
+    if (approx) {
+        float fDist = approx->getDistance(point);
+        if (fabs(fDist) > radius + margin) {
+            return fDist;
+        }
+    }
 
+    return getExactDistance(point);
+}
+
+TopoDS_Shape InspectNominalShape::getDistanceShape() const
+{
     // When having a solid then use its shell because otherwise the distance
     // for inner points will always be zero
     if (!_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID) {
         TopExp_Explorer xp;
         xp.Init(_rShape, TopAbs_SHELL);
         if (xp.More()) {
-            distss->LoadS1(xp.Current());
-            isSolid = true;
+            return xp.Current();
         }
     }
-    // distss->SetDeflection(radius);
+    return _rShape;
 }
 
-InspectNominalShape::~InspectNominalShape()
+BRepExtrema_DistShapeShape& InspectNominalShape::getDistanceQuery() const
 {
-    delete distss;
+    if (std::this_thread::get_id() == ownerThread) {
+        return *distss;
+    }
+
+    // Every worker thread loads the shape into its own instance. Only the last
+    // shape is kept, and the idle threads of the pool expire after a while.
+    thread_local DistanceQuery query;
+    if (query.shapeId != shapeId) {
+        query.distss = std::make_unique<BRepExtrema_DistShapeShape>();
+        query.distss->LoadS1(getDistanceShape());
+        query.shapeId = shapeId;
+    }
+    return *query.distss;
 }
 
-float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+float InspectNominalShape::getExactDistance(const Base::Vector3f& point) const
 {
+    BRepExtrema_DistShapeShape& query = getDistanceQuery();
     gp_Pnt pnt3d(point.x, point.y, point.z);
     BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
+    query.LoadS2(mkVert.Vertex());
 
     float fMinDist = std::numeric_limits<float>::max();
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
+    if (query.Perform() && query.NbSolution() > 0) {
+        fMinDist = (float)query.Value();
         // the shape is a solid, check if the vertex is inside
         if (isSolid) {
             if (isInsideSolid(pnt3d)) {
@@ -514,7 +615,7 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
         }
         else if (fMinDist > 0) {
             // check if the distance was computed from a face
-            if (isBelowFace(pnt3d)) {
+            if (isBelowFace(query, pnt3d)) {
                 fMinDist = -fMinDist;
             }
         }
@@ -530,14 +631,17 @@ bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
     return (classifier.State() == TopAbs_IN);
 }
 
-bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::isBelowFace(
+    const BRepExtrema_DistShapeShape& query,
+    const gp_Pnt& pnt3d
+) const
 {
     // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
+    for (Standard_Integer index = 1; index <= query.NbSolution(); index++) {
+        if (query.SupportTypeShape1(index) == BRepExtrema_IsInFace) {
+            TopoDS_Shape face = query.SupportOnShape1(index);
             Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
+            query.ParOnFaceS1(index, u, v);
             // gp_Pnt pnt = distss->PointOnShape1(index);
             BRepGProp_Face props(TopoDS::Face(face));
             gp_Vec normal;
@@ -758,6 +862,80 @@ public:
     int m_numv {0};
     double m_sumsq {0.0};
 };
+
+// A range of points in Morton order that is inspected by one task
+struct DistanceBlock
+{
+    std::size_t index;
+    unsigned long begin;
+    unsigned long end;
+};
+
+struct DistanceBlockResult
+{
+    std::size_t block {0};
+    std::vector<float> distances;
+    DistanceInspectionRMS rms;
+};
+
+// Spread the lower 10 bits of the value so that there are two zero bits between them
+static uint32_t expandMortonBits(uint32_t value)
+{
+    value = (value * 0x00010001U) & 0xFF0000FFU;
+    value = (value * 0x00000101U) & 0x0F00F00FU;
+    value = (value * 0x00000011U) & 0xC30C30C3U;
+    value = (value * 0x00000005U) & 0x49249249U;
+    return value;
+}
+
+// Returns the point indices sorted along a Morton curve. Consecutive points are
+// then close to each other and mostly query the same grid cells of the nominals.
+static std::vector<unsigned long> mortonOrder(const InspectActualGeometry& actual)
+{
+    unsigned long count = actual.countPoints();
+    std::vector<Base::Vector3f> points(count);
+    Base::BoundBox3f box;
+    for (unsigned long index = 0; index < count; index++) {
+        points[index] = actual.getPoint(index);
+        box.Add(points[index]);
+    }
+
+    const float maxCell = 1023.0F;
+    auto quantize = [maxCell](float value, float min, float length) {
+        if (length <= 0.0F) {
+            return 0U;
+        }
+        float cell = (value - min) / length * maxCell;
+        return static_cast<uint32_t>(std::clamp(cell, 0.0F, maxCell));
+    };
+
+    std::vector<uint32_t> codes(count);
+    for (unsigned long index = 0; index < count; index++) {
+        const Base::Vector3f& pnt = points[index];
+        uint32_t x = quantize(pnt.x, box.MinX, box.LengthX());
+        uint32_t y = quantize(pnt.y, box.MinY, box.LengthY());
+        uint32_t z = quantize(pnt.z, box.MinZ, box.LengthZ());
+        codes[index] = (expandMortonBits(x) << 2) | (expandMortonBits(y) << 1) | expandMortonBits(z);
+    }
+
+    std::vector<unsigned long> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&codes](unsigned long lhs, unsigned long rhs) {
+        return codes[lhs] < codes[rhs];
+    });
+    return order;
+}
+
+static std::vector<DistanceBlock> makeBlocks(unsigned long count)
+{
+    const unsigned long blockSize = 1024;
+    std::vector<DistanceBlock> blocks;
+    blocks.reserve(count / blockSize + 1);
+    for (unsigned long begin = 0; begin < count; begin += blockSize) {
+        blocks.push_back({blocks.size(), begin, std::min(begin + blockSize, count)});
+    }
+    return blocks;
+}
 }  // namespace Inspection
 
 PROPERTY_SOURCE(Inspection::Feature, App::DocumentObject)
@@ -768,7 +946,44 @@ Feature::Feature()
     ADD_PROPERTY(Thickness, (0.0));
     ADD_PROPERTY(Actual, (nullptr));
     ADD_PROPERTY(Nominals, (nullptr));
+    ADD_PROPERTY_TYPE(
+        HistogramBins,
+        (20),
+        "Statistics",
+        App::Prop_None,
+        "Number of bins of the distance histogram"
+    );
     ADD_PROPERTY(Distances, (0.0));
+
+    auto output = static_cast<App::PropertyType>(App::Prop_ReadOnly | App::Prop_Output);
+    ADD_PROPERTY_TYPE(
+        RMS,
+        (0.0),
+        "Statistics",
+        output,
+        "Root mean square of the distances inside the search radius"
+    );
+    ADD_PROPERTY_TYPE(
+        MinDistance,
+        (0.0),
+        "Statistics",
+        output,
+        "Smallest distance inside the search radius"
+    );
+    ADD_PROPERTY_TYPE(
+        MaxDistance,
+        (0.0),
+        "Statistics",
+        output,
+        "Largest distance inside the search radius"
+    );
+    ADD_PROPERTY_TYPE(
+        Histogram,
+        (0),
+        "Statistics",
+        output,
+        "Number of distances per bin, the bins evenly divide the search radius range"
+    );
 }
 
 Feature::~Feature() = default;
@@ -787,9 +1002,56 @@ short Feature::mustExecute() const
     if (Nominals.isTouched()) {
         return 1;
     }
+    if (HistogramBins.isTouched()) {
+        return 1;
+    }
     return 0;
 }
 
+void Feature::setPartialDistances(const std::vector<float>& values)
+{
+    partialResult = true;
+    try {
+        Distances.setValues(values);
+    }
+    catch (...) {
+        partialResult = false;
+        throw;
+    }
+    partialResult = false;
+}
+
+void Feature::setStatistics(const std::vector<float>& values, double rms)
+{
+    const float radius = SearchRadius.getValue();
+    const int bins = std::max<int>(HistogramBins.getValue(), 1);
+    std::vector<long> histogram(bins, 0);
+    float minDist = std::numeric_limits<float>::max();
+    float maxDist = -std::numeric_limits<float>::max();
+    for (float value : values) {
+        if (fabs(value) == std::numeric_limits<float>::max()) {
+            continue;
+        }
+
+        minDist = std::min(minDist, value);
+        maxDist = std::max(maxDist, value);
+        int bin = 0;
+        if (radius > 0.0F) {
+            bin = static_cast<int>((value + radius) / (2.0F * radius) * static_cast<float>(bins));
+        }
+        histogram[std::clamp(bin, 0, bins - 1)]++;
+    }
+
+    if (minDist > maxDist) {
+        minDist = maxDist = 0.0F;
+    }
+
+    RMS.setValue(rms);
+    MinDistance.setValue(minDist);
+    MaxDistance.setValue(maxDist);
+    Histogram.setValues(histogram);
+}
+
 App::DocumentObjectExecReturn* Feature::execute()
 {
     bool useMultithreading = true;
@@ -832,7 +1094,6 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
             nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
         }
@@ -898,10 +1159,8 @@ App::DocumentObjectExecReturn* Feature::execute()
     Base::Console().message("RMS value for '%s' with search radius [%.4f,%.4f] is: %.4f\n",
         this->Label.getValue(), -this->SearchRadius.getValue(), this->SearchRadius.getValue(), fRMS);
 #else
-    unsigned long count = actual->countPoints();
-    std::vector<float> vals(count);
-    std::function<DistanceInspectionRMS(int)> fMap = [&](unsigned int index) {
-        DistanceInspectionRMS res;
+    const float radius = this->SearchRadius.getValue();
+    auto fMap = [&](unsigned long index) {
         Base::Vector3f pnt = actual->getPoint(index);
 
         float fMinDist = std::numeric_limits<float>::max();
@@ -912,70 +1171,111 @@ App::DocumentObjectExecReturn* Feature::execute()
             }
         }
 
-        if (fMinDist > this->SearchRadius.getValue()) {
+        if (fMinDist > radius) {
             fMinDist = std::numeric_limits<float>::max();
         }
-        else if (-fMinDist > this->SearchRadius.getValue()) {
+        else if (-fMinDist > radius) {
             fMinDist = -std::numeric_limits<float>::max();
         }
-        else {
-            res.m_sumsq += static_cast<double>(fMinDist) * static_cast<double>(fMinDist);
-            res.m_numv++;
-        }
 
-        vals[index] = fMinDist;
-        return res;
+        return fMinDist;
     };
 
+    // Inspect the points in blocks of spatially close points
+    const std::vector<unsigned long> order = mortonOrder(*actual);
+    const std::vector<DistanceBlock> blocks = makeBlocks(order.size());
+    std::function<DistanceBlockResult(const DistanceBlock&)> fBlock =
+        [&](const DistanceBlock& block) {
+            DistanceBlockResult result;
+            result.block = block.index;
+            result.distances.reserve(block.end - block.begin);
+            for (unsigned long i = block.begin; i < block.end; i++) {
+                float fMinDist = fMap(order[i]);
+                if (fabs(fMinDist) < std::numeric_limits<float>::max()) {
+                    result.rms.m_sumsq += static_cast<double>(fMinDist) * static_cast<double>(fMinDist);
+                    result.rms.m_numv++;
+                }
+                result.distances.push_back(fMinDist);
+            }
+            return result;
+        };
+
+    // Points that are not inspected yet are shown as outside of the search radius
+    const unsigned long count = static_cast<unsigned long>(order.size());
+    std::vector<float> vals(count, std::numeric_limits<float>::max());
+    std::vector<bool> handled(blocks.size(), false);
     DistanceInspectionRMS res;
+    unsigned long done = 0;
+    unsigned int currentStep = 0;
+    auto addResult = [&](const DistanceBlockResult& result) {
+        if (handled[result.block]) {
+            return;
+        }
+        handled[result.block] = true;
+
+        unsigned long begin = blocks[result.block].begin;
+        for (std::size_t i = 0; i < result.distances.size(); i++) {
+            vals[order[begin + i]] = result.distances[i];
+        }
+        res += result.rms;
+        done += static_cast<unsigned long>(result.distances.size());
+
+        // Stream the partial result to the view every ten percent
+        const unsigned int step = static_cast<unsigned int>((10ULL * done) / count);
+        if (step > currentStep && done < count) {
+            currentStep = step;
+            setPartialDistances(vals);
+        }
+    };
 
     if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
-        std::iota(index.begin(), index.end(), 0);
-        // Perform map-reduce operation : compute distances and update sum of squares for RMS
-        // computation
-        QFuture<DistanceInspectionRMS> future
-            = QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
+        QFuture<DistanceBlockResult> future = QtConcurrent::mapped(blocks, fBlock);
         // Setup progress bar
         Base::SequencerLauncher seq("Inspecting...", 100);
-        unsigned int currentStep = 0;
-        const unsigned int steps = static_cast<unsigned int>(actual->countPoints());
-        QFutureWatcher<DistanceInspectionRMS> watcher;
+        unsigned int currentPercent = 0;
+        QFutureWatcher<DistanceBlockResult> watcher;
         QObject::connect(
             &watcher,
-            &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
-            [&](int value) {
-                if (steps == 0) {
-                    return;
+            &QFutureWatcher<DistanceBlockResult>::resultsReadyAt,
+            [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    addResult(watcher.resultAt(i));
                 }
-                const unsigned int step = (100U * static_cast<unsigned int>(value)) / steps;
-                if (step > currentStep) {
-                    currentStep = step;
+                const unsigned int percent = static_cast<unsigned int>((100ULL * done) / count);
+                if (percent > currentPercent) {
+                    currentPercent = percent;
                     seq.next();
                 }
             }
         );
-        // Keep UI responsive during computation
-        QEventLoop loop;
-        QObject::connect(
-            &watcher,
-            &QFutureWatcher<DistanceInspectionRMS>::finished,
-            &loop,
-            &QEventLoop::quit
-        );
-        watcher.setFuture(future);
-        loop.exec();
-        res = future.result();
+        // Keep UI responsive during computation. Without an application
+        // object there is no event loop and the results are taken at the end.
+        if (QCoreApplication::instance()) {
+            QEventLoop loop;
+            QObject::connect(
+                &watcher,
+                &QFutureWatcher<DistanceBlockResult>::finished,
+                &loop,
+                &QEventLoop::quit
+            );
+            watcher.setFuture(future);
+            loop.exec();
+        }
+        future.waitForFinished();
+        // Pick up results whose notification was not delivered before the end
+        for (int i = 0; i < future.resultCount(); i++) {
+            addResult(future.resultAt(i));
+        }
     }
     else {
         // Single-threaded operation
         std::stringstream str;
         str << "Inspecting " << this->Label.getValue() << "…";
-        Base::SequencerLauncher seq(str.str().c_str(), count);
+        Base::SequencerLauncher seq(str.str().c_str(), blocks.size());
 
-        for (unsigned int i = 0; i < count; i++) {
-            res += fMap(i);
+        for (const auto& block : blocks) {
+            addResult(fBlock(block));
+            seq.next();
         }
     }
 
@@ -987,6 +1287,7 @@ App::DocumentObjectExecReturn* Feature::execute()
         res.getRMS()
     );
     Distances.setValues(vals);
+    setStatistics(vals, res.getRMS());
 #endif
 
     delete actual;
@@ -24,6 +24,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <thread>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -160,6 +164,11 @@ private:
     Points::PointsGrid* _pGrid;
 };
 
+/** Calculates the distance to a shape.
+ * The shape is tessellated once and the distance to the tessellation is used to
+ * reject points that are clearly outside of the search radius. Only the remaining
+ * points are computed with the exact surface.
+ */
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
 {
 public:
@@ -168,13 +177,24 @@ public:
     float getDistance(const Base::Vector3f&) const override;
 
 private:
+    void tessellate();
+    TopoDS_Shape getDistanceShape() const;
+    BRepExtrema_DistShapeShape& getDistanceQuery() const;
+    float getExactDistance(const Base::Vector3f&) const;
     bool isInsideSolid(const gp_Pnt&) const;
-    bool isBelowFace(const gp_Pnt&) const;
+    bool isBelowFace(const BRepExtrema_DistShapeShape&, const gp_Pnt&) const;
 
 private:
     BRepExtrema_DistShapeShape* distss;
     const TopoDS_Shape& _rShape;
     bool isSolid {false};
+    float radius;
+    float margin {0.0F};
+    std::unique_ptr<Mesh::MeshObject> approxMesh;
+    std::unique_ptr<InspectNominalMesh> approx;
+    // distss is not thread-safe, so other threads use their own instance
+    std::thread::id ownerThread;
+    std::uint64_t shapeId;
 };
 
 class InspectionExport PropertyDistanceList: public App::PropertyLists
@@ -255,9 +275,24 @@ public:
     App::PropertyFloat Thickness;
     App::PropertyLink Actual;
     App::PropertyLinkList Nominals;
+    App::PropertyInteger HistogramBins;
     PropertyDistanceList Distances;
     //@}
 
+    /** @name Statistics */
+    //@{
+    App::PropertyFloat RMS;
+    App::PropertyFloat MinDistance;
+    App::PropertyFloat MaxDistance;
+    App::PropertyIntegerList Histogram;
+    //@}
+
+    /// True while Distances holds the partial result of a running inspection
+    bool hasPartialResult() const
+    {
+        return partialResult;
+    }
+
     /** @name Actions */
     //@{
     short mustExecute() const override;
@@ -274,6 +309,13 @@ public:
     {
         return "InspectionGui::ViewProviderInspection";
     }
+
+private:
+    void setPartialDistances(const std::vector<float>& values);
+    void setStatistics(const std::vector<float>& values, double rms);
+
+private:
+    bool partialResult {false};
 };
 
 class InspectionExport Group: public App::DocumentObjectGroup
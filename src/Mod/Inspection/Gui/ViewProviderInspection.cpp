@@ -372,8 +372,13 @@ void ViewProviderInspection::updateData(const App::Property* prop)
     else if (prop->is<Inspection::PropertyDistanceList>()) {
         // force an update of the Inventor data nodes
         if (this->pcObject) {
+            // a partial result of a running inspection only changes the colors
+            auto feature = dynamic_cast<Inspection::Feature*>(this->pcObject);
+            auto distances = static_cast<const Inspection::PropertyDistanceList*>(prop);
+            bool partial = feature && feature->hasPartialResult()
+                && distances->getSize() == this->pcCoords->point.getNum();
             App::Property* link = this->pcObject->getPropertyByName("Actual");
-            if (link) {
+            if (link && !partial) {
                 updateData(link);
             }
             setDistances();
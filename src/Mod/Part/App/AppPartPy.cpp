@@ -96,6 +96,7 @@
 #include "OCCError.h"
 #include "PartFeature.h"
 #include "PartPyCXX.h"
+#include "ShapeValidator.h"
 #include "Tools.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapePy.h"
@@ -777,6 +778,27 @@ public:
             &Module::joinSubname,
             "joinSubname(sub,mapped,subElement) -> subname\n"
         );
+        add_varargs_method(
+            "checkShapes",
+            &Module::checkShapes,
+            "checkShapes(shapes,[runBopCheck=False]) -> list of dict\n"
+            "Check the geometry of the given shapes concurrently. Each result is a dict\n"
+            "with the keys 'valid' and 'issues', the latter being a list of dicts with\n"
+            "the keys 'element', 'check' and 'message'. Results are cached by shape."
+        );
+        add_varargs_method(
+            "setAutoCheck",
+            &Module::setAutoCheck,
+            "setAutoCheck(enable) -> bool\n"
+            "Check the shapes of all recomputed Part features after each recompute and\n"
+            "warn about features that became invalid. Returns the previous state."
+        );
+        add_varargs_method(
+            "getInvalidObjects",
+            &Module::getInvalidObjects,
+            "getInvalidObjects() -> list of string\n"
+            "Full names of the features flagged invalid by the automatic check."
+        );
         initialize("This is a module working with shapes.");  // register with Python
 
         PyModule_AddObject(m_module, "BRepFeat", brepFeat.module().ptr());
@@ -2785,6 +2807,69 @@ private:
         }
         return Py::String(subname);
     }
+
+    Py::Object checkShapes(const Py::Tuple& args)
+    {
+        PyObject* pyShapes;
+        PyObject* runBopCheck = Py_False;
+        if (!PyArg_ParseTuple(args.ptr(), "O|O!", &pyShapes, &PyBool_Type, &runBopCheck)) {
+            throw Py::Exception();
+        }
+
+        std::vector<TopoDS_Shape> shapes;
+        Py::Sequence list(pyShapes);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            PyObject* item = (*it).ptr();
+            if (!PyObject_TypeCheck(item, &(Part::TopoShapePy::Type))) {
+                throw Py::TypeError("item is not a shape");
+            }
+            shapes.push_back(static_cast<Part::TopoShapePy*>(item)->getTopoShapePtr()->getShape());
+        }
+
+        std::vector<ShapeCheckResult> results;
+        {
+            Base::PyGILStateRelease release;
+            results = ShapeValidator::check(shapes, Base::asBoolean(runBopCheck));
+        }
+
+        Py::List ret;
+        for (const auto& result : results) {
+            Py::List issues;
+            for (const auto& issue : result.issues) {
+                Py::Dict dict;
+                dict.setItem("element", Py::String(issue.element));
+                dict.setItem("check", Py::String(issue.check));
+                dict.setItem("message", Py::String(issue.message));
+                issues.append(dict);
+            }
+            Py::Dict dict;
+            dict.setItem("valid", Py::Boolean(result.valid));
+            dict.setItem("issues", issues);
+            ret.append(dict);
+        }
+        return ret;
+    }
+
+    Py::Object setAutoCheck(const Py::Tuple& args)
+    {
+        PyObject* enable;
+        if (!PyArg_ParseTuple(args.ptr(), "O!", &PyBool_Type, &enable)) {
+            throw Py::Exception();
+        }
+        return Py::Boolean(ShapeValidator::setAutoCheck(Base::asBoolean(enable)));
+    }
+
+    Py::Object getInvalidObjects(const Py::Tuple& args)
+    {
+        if (!PyArg_ParseTuple(args.ptr(), "")) {
+            throw Py::Exception();
+        }
+        Py::List ret;
+        for (const auto& name : ShapeValidator::getInvalidObjects()) {
+            ret.append(Py::String(name));
+        }
+        return ret;
+    }
 };
 
 PyObject* initModule()
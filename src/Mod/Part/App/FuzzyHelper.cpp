@@ -22,6 +22,8 @@
  *                                                                         *
  **************************************************************************/
 
+#include <optional>
+
 #include <FuzzyHelper.h>
 
 using namespace Part;
@@ -29,11 +31,14 @@ using namespace Part;
 namespace
 {
 double BooleanFuzzy = 1.0;
-}
+// Set by withBooleanFuzzy() for the calling thread only, so that concurrent
+// boolean operations in other threads keep using the global value
+thread_local std::optional<double> ScopedBooleanFuzzy;
+}  // namespace
 
 double FuzzyHelper::getBooleanFuzzy()
 {
-    return BooleanFuzzy;
+    return ScopedBooleanFuzzy ? *ScopedBooleanFuzzy : BooleanFuzzy;
 }
 
 void FuzzyHelper::setBooleanFuzzy(const double base)
@@ -43,8 +48,14 @@ void FuzzyHelper::setBooleanFuzzy(const double base)
 
 void FuzzyHelper::withBooleanFuzzy(double base, std::function<void()> func)
 {
-    double oldValue = getBooleanFuzzy();
-    setBooleanFuzzy(base);
-    func();
-    setBooleanFuzzy(oldValue);
+    std::optional<double> oldValue = ScopedBooleanFuzzy;
+    ScopedBooleanFuzzy = base;
+    try {
+        func();
+    }
+    catch (...) {
+        ScopedBooleanFuzzy = oldValue;
+        throw;
+    }
+    ScopedBooleanFuzzy = oldValue;
 }
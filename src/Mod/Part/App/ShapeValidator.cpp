@@ -0,0 +1,525 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#include <BOPAlgo_ArgumentAnalyzer.hxx>
+#include <BOPAlgo_ListOfCheckResult.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepCheck_Analyzer.hxx>
+#include <BRepCheck_ListIteratorOfListOfStatus.hxx>
+#include <BRepCheck_Result.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObserver.h>
+#include <Base/Console.h>
+
+#include "PartFeature.h"
+#include "ShapeValidator.h"
+#include "TopoShape.h"
+#include "TopoShapeMapper.h"
+
+
+FC_LOG_LEVEL_INIT("Part", true, true)
+
+using namespace Part;
+
+namespace
+{
+
+// Upper bound of cached results. The key of an entry holds a reference to the shape,
+// so the entries of shapes that are no longer used elsewhere are dropped first.
+constexpr std::size_t MaxCachedShapes = 256;
+
+struct CacheEntry
+{
+    ShapeCheckResult result;
+    bool bopChecked {false};
+};
+
+struct ResultCache
+{
+    std::mutex mutex;
+    std::unordered_map<TopoDS_Shape, CacheEntry, ShapeHasher> entries;
+    fastsignals::scoped_connection connDeleteDocument;
+
+    ResultCache()
+    {
+        // The shapes of a closed document must not be kept alive by the cache
+        connDeleteDocument = App::GetApplication().signalDeleteDocument.connect(
+            [this](const App::Document&) {
+                std::lock_guard<std::mutex> lock(mutex);
+                entries.clear();
+            }
+        );
+    }
+
+    /// Drop the entries whose shape is only referenced by the cache itself.
+    /// Such a shape cannot be passed in again, so its result is of no use.
+    void prune()
+    {
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (it->first.TShape()->GetRefCount() <= 1) {
+                it = entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+};
+
+ResultCache& resultCache()
+{
+    static ResultCache cache;
+    return cache;
+}
+
+const TopAbs_ShapeEnum CheckedTypes[] = {
+    TopAbs_VERTEX,
+    TopAbs_EDGE,
+    TopAbs_WIRE,
+    TopAbs_FACE,
+    TopAbs_SHELL,
+    TopAbs_SOLID,
+    TopAbs_COMPSOLID,
+    TopAbs_COMPOUND,
+};
+
+// Maps sub-shapes to their element names, e.g. "Face3"
+class ElementNamer
+{
+public:
+    explicit ElementNamer(const TopoDS_Shape& shape)
+        : shape(shape)
+    {}
+
+    std::string name(const TopoDS_Shape& sub)
+    {
+        auto type = sub.ShapeType();
+        auto& map = maps[type];
+        if (map.IsEmpty()) {
+            TopExp::MapShapes(shape, type, map);
+        }
+        int index = map.FindIndex(sub);
+        if (index <= 0) {
+            return {};
+        }
+        return TopoShape::shapeName(type, true) + std::to_string(index);
+    }
+
+private:
+    TopoDS_Shape shape;
+    std::map<TopAbs_ShapeEnum, TopTools_IndexedMapOfShape> maps;
+};
+
+void runBRepCheck(const TopoDS_Shape& shape, bool parallel, ShapeCheckResult& res)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    BRepCheck_Analyzer checker(shape, Standard_True, parallel ? Standard_True : Standard_False);
+#else
+    (void)parallel;
+    BRepCheck_Analyzer checker(shape);
+#endif
+    if (checker.IsValid()) {
+        return;
+    }
+    res.valid = false;
+
+    for (auto type : CheckedTypes) {
+        TopTools_IndexedMapOfShape subs;
+        TopExp::MapShapes(shape, type, subs);
+        for (int i = 1; i <= subs.Extent(); ++i) {
+            const auto& sub = subs(i);
+            if (checker.IsValid(sub)) {
+                continue;
+            }
+            const Handle(BRepCheck_Result)& result = checker.Result(sub);
+            if (result.IsNull()) {
+                continue;
+            }
+            for (BRepCheck_ListIteratorOfListOfStatus it(result->StatusOnShape(sub)); it.More();
+                 it.Next()) {
+                if (it.Value() == BRepCheck_NoError) {
+                    continue;
+                }
+                res.issues.push_back(
+                    {TopoShape::shapeName(type, true) + std::to_string(i),
+                     "BRepCheck",
+                     ShapeValidator::statusText(it.Value())}
+                );
+            }
+        }
+    }
+}
+
+void runBOPCheck(const TopoDS_Shape& shape, bool parallel, ShapeCheckResult& res)
+{
+    // BOPAlgo_ArgumentAnalyzer may modify its argument, so check a copy. The copy
+    // has the same topology, so element names of faulty shapes still apply.
+    TopoDS_Shape copy = BRepBuilderAPI_Copy(shape).Shape();
+    BOPAlgo_ArgumentAnalyzer checker;
+    checker.SetShape1(copy);
+    checker.ArgumentTypeMode() = true;
+    checker.SelfInterMode() = true;
+    checker.SmallEdgeMode() = true;
+    checker.RebuildFaceMode() = true;
+    checker.ContinuityMode() = true;
+    checker.TangentMode() = true;
+    checker.MergeVertexMode() = true;
+    checker.CurveOnSurfaceMode() = true;
+    checker.MergeEdgeMode() = true;
+    checker.SetRunParallel(parallel);
+    checker.Perform();
+    if (!checker.HasFaulty()) {
+        return;
+    }
+    res.valid = false;
+
+    ElementNamer namer(copy);
+    for (BOPAlgo_ListIteratorOfListOfCheckResult it(checker.GetCheckResult()); it.More(); it.Next()) {
+        const auto& current = it.Value();
+        for (TopTools_ListIteratorOfListOfShape itFaulty(current.GetFaultyShapes1()); itFaulty.More();
+             itFaulty.Next()) {
+            res.issues.push_back(
+                {namer.name(itFaulty.Value()),
+                 "BOPCheck",
+                 ShapeValidator::statusText(current.GetCheckStatus())}
+            );
+        }
+    }
+}
+
+ShapeCheckResult checkShape(const TopoDS_Shape& shape, bool runBopCheck, bool parallel)
+{
+    ShapeCheckResult res;
+    if (shape.IsNull()) {
+        res.valid = false;
+        res.issues.push_back({std::string(), "BRepCheck", "Null shape"});
+        return res;
+    }
+    try {
+        runBRepCheck(shape, parallel, res);
+        // Like the check geometry task, only run the boolean check on shapes that
+        // pass the topological check
+        if (res.valid && runBopCheck) {
+            runBOPCheck(shape, parallel, res);
+        }
+    }
+    catch (Standard_Failure& e) {
+        res.valid = false;
+        res.issues.push_back({std::string(), "BRepCheck", e.GetMessageString()});
+    }
+    return res;
+}
+
+struct AutoCheck
+{
+    std::mutex mutex;
+    fastsignals::scoped_connection connObjectRecomputed;
+    fastsignals::scoped_connection connRecomputed;
+    std::vector<App::DocumentObjectT> recomputed;
+    std::set<std::string> invalidObjects;
+
+    void slotObjectRecomputed(const App::DocumentObject& obj)
+    {
+        if (obj.isDerivedFrom<Part::Feature>()) {
+            recomputed.emplace_back(&obj);
+        }
+    }
+
+    void slotRecomputed(const App::Document& doc)
+    {
+        std::vector<App::DocumentObject*> objs;
+        std::vector<TopoDS_Shape> shapes;
+        for (const auto& objT : recomputed) {
+            if (objT.getDocument() != &doc) {
+                continue;
+            }
+            auto feature = dynamic_cast<Part::Feature*>(objT.getObject());
+            if (!feature || feature->Shape.getShape().isNull()) {
+                continue;
+            }
+            objs.push_back(feature);
+            shapes.push_back(feature->Shape.getShape().getShape());
+        }
+        recomputed.erase(
+            std::remove_if(
+                recomputed.begin(),
+                recomputed.end(),
+                [&doc](const App::DocumentObjectT& objT) {
+                    return objT.getDocument() == &doc || !objT.getDocument();
+                }
+            ),
+            recomputed.end()
+        );
+
+        auto results = ShapeValidator::check(shapes);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::size_t i = 0; i < objs.size(); ++i) {
+            auto name = objs[i]->getFullName();
+            if (results[i].valid) {
+                invalidObjects.erase(name);
+            }
+            else if (invalidObjects.insert(name).second) {
+                const auto& issue = results[i].issues.front();
+                FC_WARN(
+                    name << " has invalid geometry: " << issue.element << " " << issue.message
+                );
+            }
+        }
+    }
+};
+
+AutoCheck& autoCheck()
+{
+    static AutoCheck check;
+    return check;
+}
+
+}  // namespace
+
+ShapeCheckResult ShapeValidator::check(const TopoDS_Shape& shape, bool runBopCheck)
+{
+    return check(std::vector<TopoDS_Shape> {shape}, runBopCheck).front();
+}
+
+std::vector<ShapeCheckResult> ShapeValidator::check(
+    const std::vector<TopoDS_Shape>& shapes,
+    bool runBopCheck
+)
+{
+    std::vector<ShapeCheckResult> results(shapes.size());
+    std::vector<int> pending;
+
+    auto& cache = resultCache();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        for (std::size_t i = 0; i < shapes.size(); ++i) {
+            auto it = cache.entries.find(shapes[i]);
+            // A shape that failed the topological check never gets a boolean check,
+            // so its cached result is final
+            if (it != cache.entries.end()
+                && (!runBopCheck || it->second.bopChecked || !it->second.result.valid)) {
+                results[i] = it->second.result;
+            }
+            else {
+                pending.push_back(static_cast<int>(i));
+            }
+        }
+    }
+
+    // With a single shape let OCCT parallelize over its sub-shapes instead
+    bool parallelSubShapes = pending.size() == 1;
+    OSD_Parallel::For(0, static_cast<int>(pending.size()), [&](int i) {
+        int index = pending[i];
+        results[index] = checkShape(shapes[index], runBopCheck, parallelSubShapes);
+    });
+
+    if (!pending.empty()) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.prune();
+        if (cache.entries.size() + pending.size() > MaxCachedShapes) {
+            cache.entries.clear();
+        }
+        for (int index : pending) {
+            if (shapes[index].IsNull()) {
+                continue;
+            }
+            auto& entry = cache.entries[shapes[index]];
+            entry.result = results[index];
+            entry.bopChecked = runBopCheck;
+        }
+    }
+    return results;
+}
+
+void ShapeValidator::clearCache()
+{
+    auto& cache = resultCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+}
+
+std::size_t ShapeValidator::cacheSize()
+{
+    auto& cache = resultCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.prune();
+    return cache.entries.size();
+}
+
+bool ShapeValidator::setAutoCheck(bool enable)
+{
+    auto& check = autoCheck();
+    bool enabled = check.connRecomputed.connected();
+    if (enable == enabled) {
+        return enabled;
+    }
+    if (enable) {
+        auto& app = App::GetApplication();
+        check.connObjectRecomputed = app.signalObjectRecomputed.connect(
+            [&check](const App::DocumentObject& obj) { check.slotObjectRecomputed(obj); }
+        );
+        check.connRecomputed = app.signalRecomputed.connect(
+            [&check](const App::Document& doc) { check.slotRecomputed(doc); }
+        );
+    }
+    else {
+        check.connObjectRecomputed.disconnect();
+        check.connRecomputed.disconnect();
+        check.recomputed.clear();
+        std::lock_guard<std::mutex> lock(check.mutex);
+        check.invalidObjects.clear();
+    }
+    return enabled;
+}
+
+bool ShapeValidator::isAutoCheck()
+{
+    return autoCheck().connRecomputed.connected();
+}
+
+std::vector<std::string> ShapeValidator::getInvalidObjects()
+{
+    auto& check = autoCheck();
+    std::lock_guard<std::mutex> lock(check.mutex);
+    return {check.invalidObjects.begin(), check.invalidObjects.end()};
+}
+
+const char* ShapeValidator::statusText(BRepCheck_Status status)
+{
+    switch (status) {
+        case BRepCheck_NoError:
+            return "No error";
+        case BRepCheck_InvalidPointOnCurve:
+            return "Invalid point on curve";
+        case BRepCheck_InvalidPointOnCurveOnSurface:
+            return "Invalid point on curve on surface";
+        case BRepCheck_InvalidPointOnSurface:
+            return "Invalid point on surface";
+        case BRepCheck_No3DCurve:
+            return "No 3D curve";
+        case BRepCheck_Multiple3DCurve:
+            return "Multiple 3D curve";
+        case BRepCheck_Invalid3DCurve:
+            return "Invalid 3D curve";
+        case BRepCheck_NoCurveOnSurface:
+            return "No curve on surface";
+        case BRepCheck_InvalidCurveOnSurface:
+            return "Invalid curve on surface";
+        case BRepCheck_InvalidCurveOnClosedSurface:
+            return "Invalid curve on closed surface";
+        case BRepCheck_InvalidSameRangeFlag:
+            return "Invalid same-range flag";
+        case BRepCheck_InvalidSameParameterFlag:
+            return "Invalid same-parameter flag";
+        case BRepCheck_InvalidDegeneratedFlag:
+            return "Invalid degenerated flag";
+        case BRepCheck_FreeEdge:
+            return "Free edge";
+        case BRepCheck_InvalidMultiConnexity:
+            return "Invalid multi-connexity";
+        case BRepCheck_InvalidRange:
+            return "Invalid range";
+        case BRepCheck_EmptyWire:
+            return "Empty wire";
+        case BRepCheck_RedundantEdge:
+            return "Redundant edge";
+        case BRepCheck_SelfIntersectingWire:
+            return "Self-intersecting wire";
+        case BRepCheck_NoSurface:
+            return "No surface";
+        case BRepCheck_InvalidWire:
+            return "Invalid wires";
+        case BRepCheck_RedundantWire:
+            return "Redundant wires";
+        case BRepCheck_IntersectingWires:
+            return "Intersecting wires";
+        case BRepCheck_InvalidImbricationOfWires:
+            return "Invalid imbrication of wires";
+        case BRepCheck_EmptyShell:
+            return "Empty shell";
+        case BRepCheck_RedundantFace:
+            return "Redundant face";
+        case BRepCheck_UnorientableShape:
+            return "Unorientable shape";
+        case BRepCheck_NotClosed:
+            return "Not closed";
+        case BRepCheck_NotConnected:
+            return "Not connected";
+        case BRepCheck_SubshapeNotInShape:
+            return "Sub-shape not in shape";
+        case BRepCheck_BadOrientation:
+            return "Bad orientation";
+        case BRepCheck_BadOrientationOfSubshape:
+            return "Bad orientation of sub-shape";
+        case BRepCheck_InvalidToleranceValue:
+            return "Invalid tolerance value";
+        case BRepCheck_CheckFail:
+            return "Check failed";
+        default:
+            return "Undetermined error";
+    }
+}
+
+const char* ShapeValidator::statusText(BOPAlgo_CheckStatus status)
+{
+    switch (status) {
+        case BOPAlgo_CheckUnknown:
+            return "BOPAlgo CheckUnknown";
+        case BOPAlgo_BadType:
+            return "BOPAlgo BadType";
+        case BOPAlgo_SelfIntersect:
+            return "BOPAlgo SelfIntersect";
+        case BOPAlgo_TooSmallEdge:
+            return "BOPAlgo TooSmallEdge";
+        case BOPAlgo_NonRecoverableFace:
+            return "BOPAlgo NonRecoverableFace";
+        case BOPAlgo_IncompatibilityOfVertex:
+            return "BOPAlgo IncompatibilityOfVertex";
+        case BOPAlgo_IncompatibilityOfEdge:
+            return "BOPAlgo IncompatibilityOfEdge";
+        case BOPAlgo_IncompatibilityOfFace:
+            return "BOPAlgo IncompatibilityOfFace";
+        case BOPAlgo_OperationAborted:
+            return "BOPAlgo OperationAborted";
+        case BOPAlgo_GeomAbs_C0:
+            return "BOPAlgo GeomAbs_C0";
+        case BOPAlgo_InvalidCurveOnSurface:
+            return "BOPAlgo_InvalidCurveOnSurface";
+        case BOPAlgo_NotValid:
+            return "BOPAlgo NotValid";
+        default:
+            return "BOPAlgo CheckUnknown";
+    }
+}
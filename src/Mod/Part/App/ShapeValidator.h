@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <BOPAlgo_CheckStatus.hxx>
+#include <BRepCheck_Status.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace Part
+{
+
+/// A single problem reported by ShapeValidator
+struct PartExport ShapeCheckIssue
+{
+    /// Name of the offending sub-shape, e.g. "Face3"
+    std::string element;
+    /// Either "BRepCheck" or "BOPCheck"
+    std::string check;
+    std::string message;
+};
+
+struct PartExport ShapeCheckResult
+{
+    bool valid {true};
+    std::vector<ShapeCheckIssue> issues;
+};
+
+/** Geometry validation without the GUI
+ *
+ * Runs BRepCheck_Analyzer and, on request, BOPAlgo_ArgumentAnalyzer on shapes.
+ * Several shapes are checked concurrently, and the results are cached by shape,
+ * so that checking an unchanged shape again is cheap. The cache is small, drops
+ * the results of shapes that are no longer used elsewhere and is cleared when a
+ * document is closed. The automatic check validates the shapes of all Part
+ * features after each recompute and warns about features whose geometry became
+ * invalid.
+ */
+class PartExport ShapeValidator
+{
+public:
+    /// Check a single shape, the sub-shapes are checked in parallel
+    static ShapeCheckResult check(const TopoDS_Shape& shape, bool runBopCheck = false);
+    /// Check a list of shapes concurrently, the results are in the same order
+    static std::vector<ShapeCheckResult> check(
+        const std::vector<TopoDS_Shape>& shapes,
+        bool runBopCheck = false
+    );
+    static void clearCache();
+    /// Number of cached results of shapes that are still in use
+    static std::size_t cacheSize();
+
+    /// Enable or disable the check after recompute, returns the previous state
+    static bool setAutoCheck(bool enable);
+    static bool isAutoCheck();
+    /// Full names of the objects that were flagged invalid by the automatic check
+    static std::vector<std::string> getInvalidObjects();
+
+    static const char* statusText(BRepCheck_Status status);
+    static const char* statusText(BOPAlgo_CheckStatus status);
+};
+
+}  // namespace Part
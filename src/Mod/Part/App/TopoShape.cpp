@@ -183,6 +183,7 @@
 #include "modelRefine.h"
 #include "PartPyCXX.h"
 #include "ProgressIndicator.h"
+#include "ShapeValidator.h"
 #include "Tools.h"
 #include "TopoShape.h"
 #include "TopoShapeCompoundPy.h"
@@ -1451,24 +1452,6 @@ std::vector<std::string> buildShapeEnumVector()
     names.emplace_back("Shape");           // TopAbs_SHAPE
     return names;
 }
-
-std::vector<std::string> buildBOPCheckResultVector()
-{
-    std::vector<std::string> results;
-    results.emplace_back("BOPAlgo CheckUnknown");             // BOPAlgo_CheckUnknown
-    results.emplace_back("BOPAlgo BadType");                  // BOPAlgo_BadType
-    results.emplace_back("BOPAlgo SelfIntersect");            // BOPAlgo_SelfIntersect
-    results.emplace_back("BOPAlgo TooSmallEdge");             // BOPAlgo_TooSmallEdge
-    results.emplace_back("BOPAlgo NonRecoverableFace");       // BOPAlgo_NonRecoverableFace
-    results.emplace_back("BOPAlgo IncompatibilityOfVertex");  // BOPAlgo_IncompatibilityOfVertex
-    results.emplace_back("BOPAlgo IncompatibilityOfEdge");    // BOPAlgo_IncompatibilityOfEdge
-    results.emplace_back("BOPAlgo IncompatibilityOfFace");    // BOPAlgo_IncompatibilityOfFace
-    results.emplace_back("BOPAlgo OperationAborted");         // BOPAlgo_OperationAborted
-    results.emplace_back("BOPAlgo GeomAbs_C0");               // BOPAlgo_GeomAbs_C0
-    results.emplace_back("BOPAlgo_InvalidCurveOnSurface");    // BOPAlgo_InvalidCurveOnSurface
-    results.emplace_back("BOPAlgo NotValid");                 // BOPAlgo_NotValid
-    return results;
-}
 }  // namespace Part
 
 bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
@@ -1536,115 +1519,7 @@ bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
 
                     BRepCheck_ListIteratorOfListOfStatus it(status);
                     while (it.More()) {
-                        BRepCheck_Status& val = it.Value();
-                        switch (val) {
-                            case BRepCheck_NoError:
-                                str << "No error" << std::endl;
-                                break;
-                            case BRepCheck_InvalidPointOnCurve:
-                                str << "Invalid point on curve" << std::endl;
-                                break;
-                            case BRepCheck_InvalidPointOnCurveOnSurface:
-                                str << "Invalid point on curve on surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidPointOnSurface:
-                                str << "Invalid point on surface" << std::endl;
-                                break;
-                            case BRepCheck_No3DCurve:
-                                str << "No 3D curve" << std::endl;
-                                break;
-                            case BRepCheck_Multiple3DCurve:
-                                str << "Multiple 3D curve" << std::endl;
-                                break;
-                            case BRepCheck_Invalid3DCurve:
-                                str << "Invalid 3D curve" << std::endl;
-                                break;
-                            case BRepCheck_NoCurveOnSurface:
-                                str << "No curve on surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidCurveOnSurface:
-                                str << "Invalid curve on surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidCurveOnClosedSurface:
-                                str << "Invalid curve on closed surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidSameRangeFlag:
-                                str << "Invalid same-range flag" << std::endl;
-                                break;
-                            case BRepCheck_InvalidSameParameterFlag:
-                                str << "Invalid same-parameter flag" << std::endl;
-                                break;
-                            case BRepCheck_InvalidDegeneratedFlag:
-                                str << "Invalid degenerated flag" << std::endl;
-                                break;
-                            case BRepCheck_FreeEdge:
-                                str << "Free edge" << std::endl;
-                                break;
-                            case BRepCheck_InvalidMultiConnexity:
-                                str << "Invalid multi-connexity" << std::endl;
-                                break;
-                            case BRepCheck_InvalidRange:
-                                str << "Invalid range" << std::endl;
-                                break;
-                            case BRepCheck_EmptyWire:
-                                str << "Empty wire" << std::endl;
-                                break;
-                            case BRepCheck_RedundantEdge:
-                                str << "Redundant edge" << std::endl;
-                                break;
-                            case BRepCheck_SelfIntersectingWire:
-                                str << "Self-intersecting wire" << std::endl;
-                                break;
-                            case BRepCheck_NoSurface:
-                                str << "No surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidWire:
-                                str << "Invalid wires" << std::endl;
-                                break;
-                            case BRepCheck_RedundantWire:
-                                str << "Redundant wires" << std::endl;
-                                break;
-                            case BRepCheck_IntersectingWires:
-                                str << "Intersecting wires" << std::endl;
-                                break;
-                            case BRepCheck_InvalidImbricationOfWires:
-                                str << "Invalid imbrication of wires" << std::endl;
-                                break;
-                            case BRepCheck_EmptyShell:
-                                str << "Empty shell" << std::endl;
-                                break;
-                            case BRepCheck_RedundantFace:
-                                str << "Redundant face" << std::endl;
-                                break;
-                            case BRepCheck_UnorientableShape:
-                                str << "Unorientable shape" << std::endl;
-                                break;
-                            case BRepCheck_NotClosed:
-                                str << "Not closed" << std::endl;
-                                break;
-                            case BRepCheck_NotConnected:
-                                str << "Not connected" << std::endl;
-                                break;
-                            case BRepCheck_SubshapeNotInShape:
-                                str << "Sub-shape not in shape" << std::endl;
-                                break;
-                            case BRepCheck_BadOrientation:
-                                str << "Bad orientation" << std::endl;
-                                break;
-                            case BRepCheck_BadOrientationOfSubshape:
-                                str << "Bad orientation of sub-shape" << std::endl;
-                                break;
-                            case BRepCheck_InvalidToleranceValue:
-                                str << "Invalid tolerance value" << std::endl;
-                                break;
-                            case BRepCheck_CheckFail:
-                                str << "Check failed" << std::endl;
-                                break;
-                            default:
-                                str << "Undetermined error" << std::endl;
-                                break;
-                        }
-
+                        str << ShapeValidator::statusText(it.Value()) << std::endl;
                         it.Next();
                     }
                 }
@@ -1676,7 +1551,6 @@ bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
 
             str << "BOP check found the following errors:" << std::endl;
             static std::vector<std::string> shapeEnumToString = buildShapeEnumVector();
-            static std::vector<std::string> bopEnumToString = buildBOPCheckResultVector();
             const BOPAlgo_ListOfCheckResult& BOPResults = BOPCheck.GetCheckResult();
             BOPAlgo_ListIteratorOfListOfCheckResult BOPResultsIt(BOPResults);
             for (; BOPResultsIt.More(); BOPResultsIt.Next()) {
@@ -1687,7 +1561,7 @@ bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
                 for (; faultyShapes1It.More(); faultyShapes1It.Next()) {
                     const TopoDS_Shape& faultyShape = faultyShapes1It.Value();
                     str << "Error in " << shapeEnumToString[faultyShape.ShapeType()] << ": ";
-                    str << bopEnumToString[current.GetCheckStatus()] << std::endl;
+                    str << ShapeValidator::statusText(current.GetCheckStatus()) << std::endl;
                 }
             }
             return false;
@@ -256,31 +256,53 @@ void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face& face, FaceVectorTyp
 void FaceEqualitySplitter::split(const FaceVectorType& faces, FaceTypedBase* object)
 {
     std::vector<FaceVectorType> tempVector;
-    tempVector.reserve(faces.size());
+    // groups sorted by the key of their first face, see FaceTypedBase::getSortKey()
+    std::multimap<double, std::size_t> keyedGroups;
+    std::vector<std::size_t> unkeyedGroups;
+
+    auto findGroup = [&](const TopoDS_Face& face, bool hasKey, double key, double tolerance) {
+        if (hasKey) {
+            auto last = keyedGroups.upper_bound(key + tolerance);
+            for (auto it = keyedGroups.lower_bound(key - tolerance); it != last; ++it) {
+                if (object->isEqual(tempVector[it->second].front(), face)) {
+                    return static_cast<int>(it->second);
+                }
+            }
+        }
+        for (std::size_t index : unkeyedGroups) {
+            if (object->isEqual(tempVector[index].front(), face)) {
+                return static_cast<int>(index);
+            }
+        }
+        return -1;
+    };
+
     FaceVectorType::const_iterator faceIt;
     for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt) {
-        bool foundMatch(false);
-        std::vector<FaceVectorType>::iterator tempIt;
-        for (tempIt = tempVector.begin(); tempIt != tempVector.end(); ++tempIt) {
-            if (object->isEqual((*tempIt).front(), *faceIt)) {
-                (*tempIt).push_back(*faceIt);
-                foundMatch = true;
-                break;
-            }
+        double key = 0.0;
+        double tolerance = 0.0;
+        bool hasKey = object->getSortKey(*faceIt, key, tolerance);
+
+        int index = findGroup(*faceIt, hasKey, key, tolerance);
+        if (index >= 0) {
+            tempVector[index].push_back(*faceIt);
+            continue;
         }
-        if (!foundMatch) {
-            FaceVectorType another;
-            another.reserve(faces.size());
-            another.push_back(*faceIt);
-            tempVector.push_back(another);
+
+        if (hasKey) {
+            keyedGroups.emplace(key, tempVector.size());
+        }
+        else {
+            unkeyedGroups.push_back(tempVector.size());
         }
+        tempVector.emplace_back(1, *faceIt);
     }
     std::vector<FaceVectorType>::iterator it;
     for (it = tempVector.begin(); it != tempVector.end(); ++it) {
         if ((*it).size() < 2) {
             continue;
         }
-        equalityVector.push_back(*it);
+        equalityVector.push_back(std::move(*it));
     }
 }
 
@@ -382,6 +404,23 @@ bool FaceTypedPlane::isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& face
     );
 }
 
+bool FaceTypedPlane::getSortKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_Plane) planeSurface = getGeomPlane(face);
+    if (planeSurface.IsNull()) {
+        return false;
+    }
+
+    // Equal planes have the same distance from the origin, up to the tolerances
+    // of isEqual(). The angular part of the difference grows with the distance
+    // of the plane location from the origin.
+    gp_Pln plane(planeSurface->Pln());
+    gp_Pnt origin(0.0, 0.0, 0.0);
+    key = plane.Distance(origin);
+    tolerance = 2.0 * Precision::Confusion() * (1.0 + plane.Position().Location().Distance(origin));
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedPlane::getType() const
 {
     return GeomAbs_Plane;
@@ -491,6 +530,18 @@ bool FaceTypedCylinder::isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& f
     return true;
 }
 
+bool FaceTypedCylinder::getSortKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_CylindricalSurface) surface = getGeomCylinder(face);
+    if (surface.IsNull()) {
+        return false;
+    }
+
+    key = surface->Radius();
+    tolerance = Precision::Confusion();
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedCylinder::getType() const
 {
     return GeomAbs_Cylinder;
@@ -1023,6 +1074,21 @@ bool FaceTypedBSpline::isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& fa
     return false;
 }
 
+bool FaceTypedBSpline::getSortKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_BSplineSurface) surface = Handle(Geom_BSplineSurface)::DownCast(
+        BRep_Tool::Surface(face)
+    );
+    if (surface.IsNull()) {
+        return false;
+    }
+
+    // equal surfaces have the same number of poles
+    key = surface->NbUPoles() * 65536.0 + surface->NbVPoles();
+    tolerance = 0.5;
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedBSpline::getType() const
 {
     return GeomAbs_BSplineSurface;
@@ -67,6 +67,17 @@ protected:
 
 public:
     virtual bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const = 0;
+    /** Get a value that differs by at most \a tolerance for equal faces.
+     *  It lets FaceEqualitySplitter compare a face only with the groups whose key
+     *  is in range instead of all groups. Returns false if there is no such key.
+     */
+    virtual bool getSortKey(const TopoDS_Face& face, double& key, double& tolerance) const
+    {
+        (void)face;
+        (void)key;
+        (void)tolerance;
+        return false;
+    }
     virtual GeomAbs_SurfaceType getType() const = 0;
     virtual TopoDS_Face buildFace(const FaceVectorType& faces) const = 0;
 
@@ -87,6 +98,7 @@ private:
 
 public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
+    bool getSortKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
     friend FaceTypedPlane& getPlaneObject();
@@ -100,6 +112,7 @@ private:
 
 public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
+    bool getSortKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
     friend FaceTypedCylinder& getCylinderObject();
@@ -119,6 +132,7 @@ private:
 
 public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
+    bool getSortKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
     friend FaceTypedBSpline& getBSplineObject();
@@ -167,7 +181,7 @@ private:
     TopTools_IndexedDataMapOfShapeListOfShape edgeToFaceMap;
 };
 
-class FaceEqualitySplitter
+class PartExport FaceEqualitySplitter
 {
 public:
     FaceEqualitySplitter() = default;
@@ -37,6 +37,7 @@
 #include <Inventor/SoPrimitiveVertex.h>
 #include <Inventor/actions/SoGetBoundingBoxAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/elements/SoLazyElement.h>
@@ -1107,6 +1108,63 @@ void SoBrepFaceSet::getBoundingBox(SoGetBoundingBoxAction* action)
     }
 }
 
+/**
+ * Returns the bounding box of each part. The boxes are cached and only
+ * recomputed when this node or the coordinates have changed. An empty list
+ * is returned if the face set is not made of plain triangles.
+ */
+const std::vector<SbBox3f>& SoBrepFaceSet::getPartBoundingBoxes(const SoCoordinateElement* coords)
+{
+    if (partBoxesNodeId == this->getNodeId() && partBoxesCoordId == coords->getNodeId()) {
+        return partBoxes;
+    }
+
+    partBoxesNodeId = this->getNodeId();
+    partBoxesCoordId = coords->getNodeId();
+    partBoxes.clear();
+
+    const int32_t* cindices = this->coordIndex.getValues(0);
+    int numindices = this->coordIndex.getNum();
+    const int32_t* pindices = this->partIndex.getValues(0);
+    int numparts = this->partIndex.getNum();
+    int numcoords = coords->getNum();
+
+    int numtriangles = 0;
+    for (int i = 0; i < numparts; i++) {
+        numtriangles += pindices[i];
+    }
+    if (numtriangles * 4 != numindices) {
+        return partBoxes;
+    }
+
+    partBoxes.resize(numparts);
+    const int32_t* viptr = cindices;
+    for (int i = 0; i < numparts; i++) {
+        SbBox3f& box = partBoxes[i];
+        for (int j = 0; j < pindices[i]; j++) {
+            for (int k = 0; k < 3; k++) {
+                int32_t idx = *viptr++;
+                if (idx < 0 || idx >= numcoords) {
+                    partBoxes.clear();
+                    return partBoxes;
+                }
+                box.extendBy(coords->get3(idx));
+            }
+            // skip the -1 separator
+            ++viptr;
+        }
+        if (!box.isEmpty()) {
+            // pad the box so that flat faces aligned with an axis are hit reliably
+            float pad = (box.getMax() - box.getMin()).length() * 1e-4F
+                + std::numeric_limits<float>::epsilon();
+            SbVec3f offset(pad, pad, pad);
+            box.setBounds(box.getMin() - offset, box.getMax() + offset);
+        }
+    }
+
+    return partBoxes;
+}
+
 // this macro actually makes the code below more readable  :-)
 #define DO_VERTEX(idx) \
     if (mbind == PER_VERTEX) { \
@@ -1138,7 +1196,8 @@ void SoBrepFaceSet::getBoundingBox(SoGetBoundingBoxAction* action)
     } \
     vertex.setPoint(coords->get3(idx)); \
     pointDetail.setCoordinateIndex(idx); \
-    this->shapeVertex(&vertex);
+    if (!culled) \
+        this->shapeVertex(&vertex);
 
 void SoBrepFaceSet::generatePrimitives(SoAction* action)
 {
@@ -1261,6 +1320,23 @@ void SoBrepFaceSet::generatePrimitives(SoAction* action)
     }
     vertex.setNormal(*currnormal);
 
+    // When picking, the vertices of parts whose bounding box is missed by the
+    // pick ray are not sent, so no triangle intersection tests are done for
+    // them. Their indices are still walked through to keep the bindings in sync.
+    SoRayPickAction* pickAction = nullptr;
+    const std::vector<SbBox3f>* boxes = nullptr;
+    if (action->isOfType(SoRayPickAction::getClassTypeId())) {
+        pickAction = static_cast<SoRayPickAction*>(action);
+        boxes = &getPartBoundingBoxes(coords);
+    }
+    const int32_t* pistartptr = piptr;
+    bool culled = false;
+    auto cullPart = [&]() {
+        int partnr = static_cast<int>(piptr - pistartptr) - 1;
+        culled = boxes && partnr >= 0 && partnr < static_cast<int>(boxes->size())
+            && !pickAction->intersect((*boxes)[partnr]);
+    };
+
     int matnr = 0;
     int normnr = 0;
     int trinr = 0;
@@ -1275,6 +1351,7 @@ void SoBrepFaceSet::generatePrimitives(SoAction* action)
             mindices++;
         }
     }
+    cullPart();
 
     while (viptr + 2 < viendptr) {
         v1 = *viptr++;
@@ -1351,7 +1428,9 @@ void SoBrepFaceSet::generatePrimitives(SoAction* action)
         }
         pointDetail.setCoordinateIndex(v1);
         vertex.setPoint(coords->get3(v1));
-        this->shapeVertex(&vertex);
+        if (!culled) {
+            this->shapeVertex(&vertex);
+        }
 
         DO_VERTEX(v2);
         DO_VERTEX(v3);
@@ -1393,6 +1472,7 @@ void SoBrepFaceSet::generatePrimitives(SoAction* action)
                 }
             }
             trinr = 0;
+            cullPart();
         }
     }
     if (mode != POLYGON) {
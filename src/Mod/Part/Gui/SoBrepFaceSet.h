@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <Inventor/SbBox3f.h>
 #include <Inventor/fields/SoMFInt32.h>
 #include <Inventor/fields/SoSFInt32.h>
 #include <Inventor/fields/SoSFColor.h>
@@ -34,6 +35,7 @@
 #include <Mod/Part/PartGlobal.h>
 
 
+class SoCoordinateElement;
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
@@ -160,6 +162,8 @@ private:
 
     bool overrideMaterialBinding(SoGLRenderAction* action, SelContextPtr ctx, SelContextPtr ctx2);
 
+    const std::vector<SbBox3f>& getPartBoundingBoxes(const SoCoordinateElement* coords);
+
 #ifdef RENDER_GLARRAYS
     void renderSimpleArray();
     void renderColoredArray(SoMaterialBundle* const materials);
@@ -183,6 +187,12 @@ private:
 
     // backreference to viewprovider that owns this node
     ViewProviderPartExt* viewProvider = nullptr;
+
+    // Bounding box of each part, used to skip parts missed by a pick ray.
+    // The node ids tell whether the boxes are still valid.
+    std::vector<SbBox3f> partBoxes;
+    SbUniqueId partBoxesNodeId = 0;
+    SbUniqueId partBoxesCoordId = 0;
 };
 
 }  // namespace PartGui
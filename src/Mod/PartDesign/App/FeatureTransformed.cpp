@@ -362,21 +362,38 @@ App::DocumentObjectExecReturn* Transformed::execute()
 
     supportShape.setTransform(Base::Matrix4D());
 
-    auto getTransformedCompShape = [&](const auto& supportShape, const auto& origShape) {
-        std::vector<TopoShape> shapes = {supportShape};
-        TopoShape shape(origShape);
-        int idx = 1;
-        auto transformIter = transformations.cbegin();
-        transformIter++;
-        for (; transformIter != transformations.end(); transformIter++) {
-            if (Base::Sequencer().wasCanceled()) {
-                return std::vector<TopoShape>();
+    // If skipDisjoint is set, copies whose bounding box misses the support are left out. This
+    // is only valid for cuts, where such a copy cannot change the result, but it spares the
+    // boolean from classifying e.g. the parts of a large hole pattern that run off the support.
+    // The copies that do touch the support are all passed to a single multi-argument cut, as
+    // before, so a pattern of holes that lies completely inside a panel gains nothing from it.
+    // The index suffix of the remaining copies is kept, so element names do not depend on it.
+    auto getTransformedCompShape =
+        [&](const auto& supportShape, const auto& origShape, bool skipDisjoint = false) {
+            std::vector<TopoShape> shapes = {supportShape};
+            TopoShape shape(origShape);
+            Bnd_Box supportBox, shapeBox;
+            if (skipDisjoint) {
+                BRepBndLib::Add(supportShape.getShape(), supportBox);
+                BRepBndLib::Add(shape.getShape(), shapeBox);
+                supportBox.SetGap(Precision::Confusion());
             }
-            auto opName = Data::indexSuffix(idx++);
-            shapes.emplace_back(shape.makeElementTransform(*transformIter, opName.c_str()));
-        }
-        return shapes;
-    };
+            int idx = 1;
+            auto transformIter = transformations.cbegin();
+            transformIter++;
+            for (; transformIter != transformations.end(); transformIter++) {
+                if (Base::Sequencer().wasCanceled()) {
+                    return std::vector<TopoShape>();
+                }
+                auto opName = Data::indexSuffix(idx++);
+                if (skipDisjoint && !supportBox.IsVoid() && !shapeBox.IsVoid()
+                    && shapeBox.Transformed(*transformIter).IsOut(supportBox)) {
+                    continue;
+                }
+                shapes.emplace_back(shape.makeElementTransform(*transformIter, opName.c_str()));
+            }
+            return shapes;
+        };
 
     switch (mode) {
         case Mode::Features:
@@ -420,11 +437,13 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     supportShape.makeElementFuse(shapes);
                 }
                 if (!cutShape.isNull()) {
-                    auto shapes = getTransformedCompShape(supportShape, cutShape);
+                    auto shapes = getTransformedCompShape(supportShape, cutShape, true);
                     if (Base::Sequencer().wasCanceled()) {
                         return new App::DocumentObjectExecReturn("User aborted");
                     }
-                    supportShape.makeElementCut(shapes);
+                    if (shapes.size() > 1) {
+                        supportShape.makeElementCut(shapes);
+                    }
                 }
             }
             break;
@@ -22,6 +22,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <memory>
+
 #include <Geom_BSplineSurface.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 
@@ -45,6 +47,7 @@
 #include "RegionGrowing.h"
 #include "SampleConsensus.h"
 #include "Segmentation.h"
+#include "SurfaceReconstruction.h"
 #include "SurfaceTriangulation.h"
 
 // clang-format off
@@ -95,6 +98,20 @@ public:
             "UVDirs: set the u,v parameter directions as tuple of two vectors\n"
             "        If not set then they will be determined by computing a best-fit plane\n"
         );
+        add_keyword_method("estimateNormals",&Module::estimateNormals,
+            "estimateNormals(Points, KSearch=10) -> Normals\n"
+            "Estimate consistently oriented normals from the KSearch nearest\n"
+            "neighbours of each point. Does not need PCL.\n"
+        );
+        add_keyword_method("reconstructSurface",&Module::reconstructSurface,
+            "reconstructSurface(Points, KSearch=10, CellSize=0.0, Normals=None) -> Mesh\n"
+            "Reconstruct a mesh from the signed distance to the tangent planes of\n"
+            "the points. Does not need PCL.\n"
+            "KSearch: number of neighbours for the normal estimation\n"
+            "CellSize: edge length of the voxels, by default twice the average\n"
+            "          distance between neighbouring points\n"
+            "Normals: oriented normals of the points, estimated if not given\n"
+        );
 #if defined(HAVE_PCL_SURFACE)
         add_keyword_method("triangulate",&Module::triangulate,
             "triangulate(PointKernel,searchRadius[,mu=2.5])."
@@ -450,6 +467,86 @@ private:
             throw Py::RuntimeError("Unknown C++ exception");
         }
     }
+    Py::Object estimateNormals(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        int ksearch=10;
+
+        static const std::array<const char*,3> kwds_normals {"Points", "KSearch", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|i", kwds_normals,
+                                        &(Points::PointsPy::Type), &pts,
+                                        &ksearch))
+            throw Py::Exception();
+
+        if (ksearch < 3) {
+            throw Py::ValueError("KSearch must be at least 3");
+        }
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+
+        std::vector<Base::Vector3f> normals;
+        try {
+            PointNormalEstimation estimate(*points);
+            estimate.setKSearch(ksearch);
+            normals = estimate.perform();
+        }
+        catch (const Base::Exception &e) {
+            throw Py::RuntimeError(e.what());
+        }
+
+        Py::List list;
+        for (const auto& it : normals) {
+            list.append(Py::Vector(it));
+        }
+
+        return list;
+    }
+    Py::Object reconstructSurface(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        PyObject *vec = nullptr;
+        int ksearch=10;
+        double cellSize=0.0;
+
+        static const std::array<const char*,5> kwds_reconstruct {"Points", "KSearch", "CellSize", "Normals", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|idO", kwds_reconstruct,
+                                        &(Points::PointsPy::Type), &pts,
+                                        &ksearch, &cellSize, &vec))
+            throw Py::Exception();
+
+        if (ksearch < 3) {
+            throw Py::ValueError("KSearch must be at least 3");
+        }
+        if (cellSize < 0.0) {
+            throw Py::ValueError("CellSize must not be negative");
+        }
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+
+        std::unique_ptr<Mesh::MeshObject> mesh = std::make_unique<Mesh::MeshObject>();
+        try {
+            Reen::SurfaceReconstruction reconstruction(*points, *mesh);
+            reconstruction.setCellSize(cellSize);
+            if (vec && vec != Py_None) {
+                Py::Sequence list(vec);
+                std::vector<Base::Vector3f> normals;
+                normals.reserve(list.size());
+                for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                    Base::Vector3d v = Py::Vector(*it).toVector();
+                    normals.push_back(Base::convertTo<Base::Vector3f>(v));
+                }
+                reconstruction.perform(normals);
+            }
+            else {
+                reconstruction.perform(ksearch);
+            }
+        }
+        catch (const Base::Exception &e) {
+            throw Py::RuntimeError(e.what());
+        }
+
+        return Py::asObject(new Mesh::MeshPy(mesh.release()));
+    }
 #if defined(HAVE_PCL_SURFACE)
     /*
 import ReverseEngineering as Reen
@@ -0,0 +1,857 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+#include <Eigen/Eigenvalues>
+#include <QtConcurrentMap>
+
+#include <Base/BoundBox.h>
+#include <Base/Exception.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Points/App/Points.h>
+
+#include "SurfaceReconstruction.h"
+
+
+using namespace Reen;
+
+namespace
+{
+
+// Number of bits per axis of a packed cell key
+constexpr int keyBits = 20;
+constexpr int64_t maxCell = (int64_t(1) << keyBits) - 1;
+
+uint64_t packKey(int64_t x, int64_t y, int64_t z)
+{
+    return (uint64_t(x) << (2 * keyBits)) | (uint64_t(y) << keyBits) | uint64_t(z);
+}
+
+void unpackKey(uint64_t key, int64_t& x, int64_t& y, int64_t& z)
+{
+    x = int64_t(key >> (2 * keyBits)) & maxCell;
+    y = int64_t(key >> keyBits) & maxCell;
+    z = int64_t(key) & maxCell;
+}
+
+// A range of elements that is processed by one task
+struct Range
+{
+    std::size_t index;
+    std::size_t begin;
+    std::size_t end;
+};
+
+std::vector<Range> makeRanges(std::size_t count, std::size_t size)
+{
+    std::vector<Range> ranges;
+    ranges.reserve(count / size + 1);
+    for (std::size_t begin = 0; begin < count; begin += size) {
+        ranges.push_back({ranges.size(), begin, std::min(begin + size, count)});
+    }
+    return ranges;
+}
+
+std::vector<Base::Vector3f> getPoints(const Points::PointKernel& kernel)
+{
+    std::vector<Base::Vector3f> points;
+    points.reserve(kernel.size());
+    for (const auto& it : kernel) {
+        points.emplace_back(float(it.x), float(it.y), float(it.z));
+    }
+    return points;
+}
+
+Base::BoundBox3f getBoundBox(const std::vector<Base::Vector3f>& points)
+{
+    Base::BoundBox3f box;
+    for (const auto& it : points) {
+        box.Add(it);
+    }
+    return box;
+}
+
+// For points sampled from a surface a cell of this size holds about k points
+float neighbourCellSize(const std::vector<Base::Vector3f>& points, int k)
+{
+    float diagonal = getBoundBox(points).CalcDiagonalLength();
+    float size = diagonal * std::sqrt(float(k) / float(std::max<std::size_t>(points.size(), 1)));
+    return size > 0.0F ? size : 1.0F;
+}
+
+/** A uniform grid of points that only stores the occupied cells.
+ * The point indices are sorted by their cell, so that a cell is a contiguous
+ * range of indices. This needs much less memory than a grid of sets.
+ */
+class PointGrid
+{
+public:
+    PointGrid(const std::vector<Base::Vector3f>& points, float cellSize)
+        : points(points)
+        , cellSize(cellSize)
+    {
+        Base::BoundBox3f box = getBoundBox(points);
+        origin.Set(box.MinX, box.MinY, box.MinZ);
+        float length = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+        if (length / cellSize >= float(maxCell)) {
+            throw Base::ValueError("The cell size is too small for the extent of the points");
+        }
+
+        std::vector<uint64_t> keys(points.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            int64_t x {}, y {}, z {};
+            position(points[i], x, y, z);
+            keys[i] = packKey(x, y, z);
+        }
+
+        indices.resize(points.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        std::sort(indices.begin(), indices.end(), [&keys](uint32_t lhs, uint32_t rhs) {
+            return keys[lhs] < keys[rhs];
+        });
+
+        for (std::size_t i = 0; i < indices.size(); i++) {
+            uint64_t key = keys[indices[i]];
+            if (cellKeys.empty() || cellKeys.back() != key) {
+                cellKeys.push_back(key);
+                cellStarts.push_back(i);
+            }
+        }
+        cellStarts.push_back(indices.size());
+    }
+
+    /// Calls \a func with the index of every point in the cells up to \a rings cells around \a pnt
+    template<typename Func>
+    void forEachNear(const Base::Vector3f& pnt, int rings, Func&& func) const
+    {
+        int64_t x {}, y {}, z {};
+        position(pnt, x, y, z);
+        for (int64_t i = std::max<int64_t>(x - rings, 0); i <= std::min(x + rings, maxCell); i++) {
+            for (int64_t j = std::max<int64_t>(y - rings, 0); j <= std::min(y + rings, maxCell); j++) {
+                for (int64_t k = std::max<int64_t>(z - rings, 0); k <= std::min(z + rings, maxCell);
+                     k++) {
+                    uint64_t key = packKey(i, j, k);
+                    auto it = std::lower_bound(cellKeys.begin(), cellKeys.end(), key);
+                    if (it == cellKeys.end() || *it != key) {
+                        continue;
+                    }
+                    std::size_t cell = it - cellKeys.begin();
+                    for (std::size_t n = cellStarts[cell]; n < cellStarts[cell + 1]; n++) {
+                        func(indices[n]);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Gets the k nearest points of \a pnt as pairs of squared distance and index
+    void nearest(
+        const Base::Vector3f& pnt,
+        std::size_t k,
+        std::vector<std::pair<float, uint32_t>>& result
+    ) const
+    {
+        for (int rings = 1; rings <= 2; rings++) {
+            result.clear();
+            forEachNear(pnt, rings, [&](uint32_t index) {
+                result.emplace_back(Base::DistanceP2(pnt, points[index]), index);
+            });
+            if (result.size() >= k) {
+                break;
+            }
+        }
+
+        k = std::min(k, result.size());
+        std::partial_sort(result.begin(), result.begin() + k, result.end());
+        result.resize(k);
+    }
+
+private:
+    void position(const Base::Vector3f& pnt, int64_t& x, int64_t& y, int64_t& z) const
+    {
+        auto cell = [this](float value, float min) {
+            auto index = static_cast<int64_t>(std::floor((value - min) / cellSize));
+            return std::clamp<int64_t>(index, 0, maxCell);
+        };
+        x = cell(pnt.x, origin.x);
+        y = cell(pnt.y, origin.y);
+        z = cell(pnt.z, origin.z);
+    }
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    float cellSize;
+    Base::Vector3f origin;
+    std::vector<uint32_t> indices;
+    std::vector<uint64_t> cellKeys;
+    std::vector<std::size_t> cellStarts;
+};
+
+float averageSpacing(const std::vector<Base::Vector3f>& points, const PointGrid& grid)
+{
+    const std::size_t samples = 1000;
+    std::size_t step = std::max<std::size_t>(points.size() / samples, 1);
+    std::vector<std::pair<float, uint32_t>> neighbours;
+    double sum = 0.0;
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < points.size(); i += step) {
+        grid.nearest(points[i], 2, neighbours);
+        if (neighbours.size() == 2) {
+            sum += std::sqrt(neighbours[1].first);
+            count++;
+        }
+    }
+
+    return count > 0 ? float(sum / double(count)) : 0.0F;
+}
+
+// The normal is the eigenvector of the smallest eigenvalue of the covariance matrix
+Base::Vector3f fitNormal(
+    const std::vector<Base::Vector3f>& points,
+    const std::vector<std::pair<float, uint32_t>>& neighbours
+)
+{
+    if (neighbours.size() < 3) {
+        return Base::Vector3f();
+    }
+
+    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+    for (const auto& it : neighbours) {
+        const Base::Vector3f& pnt = points[it.second];
+        mean += Eigen::Vector3d(pnt.x, pnt.y, pnt.z);
+    }
+    mean /= double(neighbours.size());
+
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    for (const auto& it : neighbours) {
+        const Base::Vector3f& pnt = points[it.second];
+        Eigen::Vector3d diff = Eigen::Vector3d(pnt.x, pnt.y, pnt.z) - mean;
+        covariance += diff * diff.transpose();
+    }
+
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+    Eigen::Vector3d normal = solver.eigenvectors().col(0);
+    return Base::Vector3f(float(normal.x()), float(normal.y()), float(normal.z()));
+}
+
+/** A binary min-heap of the points that are not yet part of the spanning tree,
+ * keyed by their cheapest edge to the tree. Every point is at most once in the
+ * heap and its key is lowered in place, so the heap never holds more entries
+ * than there are points.
+ */
+class EdgeHeap
+{
+public:
+    struct Edge
+    {
+        float weight;
+        uint32_t from;
+        uint32_t to;
+    };
+
+    explicit EdgeHeap(std::size_t count)
+        : position(count, none)
+    {}
+
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    /// Adds the edge if its target is not in the heap yet or if it is cheaper
+    void push(const Edge& edge)
+    {
+        std::size_t pos = position[edge.to];
+        if (pos == none) {
+            pos = heap.size();
+            heap.push_back(edge);
+        }
+        else if (edge.weight < heap[pos].weight) {
+            heap[pos] = edge;
+        }
+        else {
+            return;
+        }
+        position[edge.to] = pos;
+        siftUp(pos);
+    }
+
+    Edge pop()
+    {
+        Edge top = heap.front();
+        position[top.to] = none;
+        heap.front() = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            position[heap.front().to] = 0;
+            siftDown(0);
+        }
+        return top;
+    }
+
+private:
+    void swapEntries(std::size_t lhs, std::size_t rhs)
+    {
+        std::swap(heap[lhs], heap[rhs]);
+        position[heap[lhs].to] = lhs;
+        position[heap[rhs].to] = rhs;
+    }
+
+    void siftUp(std::size_t pos)
+    {
+        while (pos > 0) {
+            std::size_t parent = (pos - 1) / 2;
+            if (heap[parent].weight <= heap[pos].weight) {
+                break;
+            }
+            swapEntries(parent, pos);
+            pos = parent;
+        }
+    }
+
+    void siftDown(std::size_t pos)
+    {
+        for (;;) {
+            std::size_t best = pos;
+            for (std::size_t child = 2 * pos + 1; child <= 2 * pos + 2 && child < heap.size();
+                 child++) {
+                if (heap[child].weight < heap[best].weight) {
+                    best = child;
+                }
+            }
+            if (best == pos) {
+                break;
+            }
+            swapEntries(best, pos);
+            pos = best;
+        }
+    }
+
+private:
+    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+    std::vector<Edge> heap;
+    std::vector<std::size_t> position;
+};
+
+// The k nearest neighbours of every point, unused entries are set to noPoint
+constexpr uint32_t noPoint = std::numeric_limits<uint32_t>::max();
+
+// Propagate the orientation along a minimum spanning tree (Hoppe et al.) where
+// the edges between nearly parallel normals are the cheapest. The graph is made
+// of the neighbour lists of the normal estimation.
+void orientNormals(
+    const std::vector<Base::Vector3f>& points,
+    const std::vector<uint32_t>& neighbours,
+    std::size_t k,
+    std::vector<Base::Vector3f>& normals
+)
+{
+    if (points.empty()) {
+        return;
+    }
+
+    Base::Vector3d sum;
+    for (const auto& it : points) {
+        sum += Base::Vector3d(it.x, it.y, it.z);
+    }
+    sum /= double(points.size());
+    Base::Vector3f center(float(sum.x), float(sum.y), float(sum.z));
+
+    std::vector<bool> visited(points.size(), false);
+    EdgeHeap heap(points.size());
+    auto visit = [&](uint32_t index) {
+        visited[index] = true;
+        for (std::size_t i = index * k; i < (index + 1) * k; i++) {
+            uint32_t next = neighbours[i];
+            if (next != noPoint && !visited[next]) {
+                float weight = 1.0F - std::fabs(normals[index] * normals[next]);
+                heap.push({weight, index, next});
+            }
+        }
+    };
+
+    auto propagate = [&](uint32_t seed) {
+        // the seed of a component points away from the center of the cloud
+        if (normals[seed] * (points[seed] - center) < 0.0F) {
+            normals[seed] = -normals[seed];
+        }
+        visit(seed);
+        while (!heap.empty()) {
+            EdgeHeap::Edge edge = heap.pop();
+            if (normals[edge.from] * normals[edge.to] < 0.0F) {
+                normals[edge.to] = -normals[edge.to];
+            }
+            visit(edge.to);
+        }
+    };
+
+    // the point farthest from the center is the most reliable seed
+    uint32_t farthest = 0;
+    float maxDist = -1.0F;
+    for (uint32_t i = 0; i < points.size(); i++) {
+        float dist = Base::DistanceP2(points[i], center);
+        if (dist > maxDist) {
+            maxDist = dist;
+            farthest = i;
+        }
+    }
+
+    propagate(farthest);
+    for (uint32_t i = 0; i < points.size(); i++) {
+        if (!visited[i]) {
+            propagate(i);
+        }
+    }
+}
+
+std::vector<Base::Vector3f> estimateNormals(
+    const std::vector<Base::Vector3f>& points,
+    const PointGrid& grid,
+    int k
+)
+{
+    // keep the neighbour lists for the orientation instead of searching them again
+    const auto count = std::size_t(k);
+    std::vector<uint32_t> neighbours(points.size() * count, noPoint);
+    std::vector<Base::Vector3f> normals(points.size());
+    std::vector<Range> ranges = makeRanges(points.size(), 4096);
+    QtConcurrent::blockingMap(ranges, [&](Range& range) {
+        std::vector<std::pair<float, uint32_t>> nearest;
+        for (std::size_t i = range.begin; i < range.end; i++) {
+            grid.nearest(points[i], count, nearest);
+            normals[i] = fitNormal(points, nearest);
+            for (std::size_t j = 0; j < nearest.size(); j++) {
+                neighbours[i * count + j] = nearest[j].second;
+            }
+        }
+    });
+
+    orientNormals(points, neighbours, count, normals);
+    return normals;
+}
+
+// The triangles of one range of voxels, the vertices are identified by the
+// edge of the voxel grid they lie on
+struct Polygonization
+{
+    std::vector<std::pair<uint64_t, Base::Vector3f>> vertices;
+    std::vector<std::array<uint64_t, 3>> triangles;
+    // Neighbour voxels the surface continues into
+    std::vector<uint64_t> neighbours;
+};
+
+// The corners of the six faces of a voxel and the direction of the neighbour
+struct VoxelFace
+{
+    std::array<int, 4> corners;
+    int dx;
+    int dy;
+    int dz;
+};
+
+constexpr std::array<VoxelFace, 6> voxelFaces {{
+    {{0, 2, 4, 6}, -1, 0, 0},
+    {{1, 3, 5, 7}, 1, 0, 0},
+    {{0, 1, 4, 5}, 0, -1, 0},
+    {{2, 3, 6, 7}, 0, 1, 0},
+    {{0, 1, 2, 3}, 0, 0, -1},
+    {{4, 5, 6, 7}, 0, 0, 1},
+}};
+
+// The six tetrahedra of the Kuhn triangulation of a voxel. The corners are
+// numbered by their offset bits x=1, y=2, z=4. The triangulation is the same
+// for all voxels, so the faces of neighbouring voxels match.
+constexpr std::array<std::array<int, 4>, 6> tetrahedra {{
+    {0, 1, 3, 7},
+    {0, 1, 5, 7},
+    {0, 2, 3, 7},
+    {0, 2, 6, 7},
+    {0, 4, 5, 7},
+    {0, 4, 6, 7},
+}};
+
+// The distance values of the voxel corners that have been evaluated by a task
+using CornerCache = std::unordered_map<uint64_t, float>;
+
+class Polygonizer
+{
+public:
+    Polygonizer(
+        const std::vector<Base::Vector3f>& points,
+        const std::vector<Base::Vector3f>& normals,
+        const PointGrid& grid,
+        const Base::Vector3f& origin,
+        float cellSize,
+        float maxDist
+    )
+        : points(points)
+        , normals(normals)
+        , grid(grid)
+        , origin(origin)
+        , cellSize(cellSize)
+        , maxDist(maxDist)
+    {}
+
+    void polygonize(uint64_t voxel, Polygonization& result, CornerCache& cache) const
+    {
+        int64_t x {}, y {}, z {};
+        unpackKey(voxel, x, y, z);
+
+        std::array<float, 8> values {};
+        std::array<Base::Vector3f, 8> corners;
+        bool positive = false;
+        bool negative = false;
+        for (int c = 0; c < 8; c++) {
+            int64_t cx = x + (c & 1);
+            int64_t cy = y + ((c >> 1) & 1);
+            int64_t cz = z + ((c >> 2) & 1);
+            corners[c] = cornerPosition(cx, cy, cz);
+            // a corner is shared by up to eight voxels
+            auto it = cache.try_emplace(packKey(cx, cy, cz), 0.0F);
+            if (it.second) {
+                it.first->second = distance(corners[c]);
+            }
+            values[c] = it.first->second;
+            positive |= values[c] > 0.0F;
+            negative |= values[c] < 0.0F;
+        }
+
+        if (!positive || !negative) {
+            return;
+        }
+
+        for (const auto& tet : tetrahedra) {
+            polygonize(x, y, z, tet, corners, values, result);
+        }
+
+        for (const auto& face : voxelFaces) {
+            if (crossesFace(face, values)) {
+                result.neighbours.push_back(packKey(x + face.dx, y + face.dy, z + face.dz));
+            }
+        }
+    }
+
+private:
+    static bool crossesFace(const VoxelFace& face, const std::array<float, 8>& values)
+    {
+        bool positive = false;
+        bool negative = false;
+        for (int c : face.corners) {
+            if (std::isnan(values[c])) {
+                return false;
+            }
+            positive |= values[c] > 0.0F;
+            negative |= values[c] < 0.0F;
+        }
+        return positive && negative;
+    }
+
+    Base::Vector3f cornerPosition(int64_t x, int64_t y, int64_t z) const
+    {
+        return origin + Base::Vector3f(float(x), float(y), float(z)) * cellSize;
+    }
+
+    // Signed distance to the tangent plane of the nearest point, NaN if there is
+    // no point within the maximum distance
+    float distance(const Base::Vector3f& pos) const
+    {
+        float best = maxDist * maxDist;
+        uint32_t nearest = std::numeric_limits<uint32_t>::max();
+        grid.forEachNear(pos, 1, [&](uint32_t index) {
+            float dist = Base::DistanceP2(pos, points[index]);
+            if (dist < best) {
+                best = dist;
+                nearest = index;
+            }
+        });
+
+        if (nearest == std::numeric_limits<uint32_t>::max()) {
+            return std::numeric_limits<float>::quiet_NaN();
+        }
+
+        float value = (pos - points[nearest]) * normals[nearest];
+        // a zero value would put several vertices onto the same corner
+        if (value == 0.0F) {
+            value = std::numeric_limits<float>::min();
+        }
+        return value;
+    }
+
+    void polygonize(
+        int64_t x,
+        int64_t y,
+        int64_t z,
+        const std::array<int, 4>& tet,
+        const std::array<Base::Vector3f, 8>& corners,
+        const std::array<float, 8>& values,
+        Polygonization& result
+    ) const
+    {
+        std::array<int, 4> inner {};
+        std::array<int, 4> outer {};
+        int numInner = 0;
+        int numOuter = 0;
+        for (int c : tet) {
+            if (std::isnan(values[c])) {
+                return;
+            }
+            if (values[c] < 0.0F) {
+                inner[numInner++] = c;
+            }
+            else {
+                outer[numOuter++] = c;
+            }
+        }
+
+        if (numInner == 0 || numOuter == 0) {
+            return;
+        }
+
+        // Vertices on the edge between two corners. In a Kuhn tetrahedron the
+        // offset bits of one corner are a subset of the other's.
+        auto vertex = [&](int a, int b) {
+            int lo = (a & b) == a ? a : b;
+            int hi = lo == a ? b : a;
+            uint64_t corner = packKey(x + (lo & 1), y + ((lo >> 1) & 1), z + ((lo >> 2) & 1));
+            uint64_t key = (corner << 3) | uint64_t(hi & ~lo);
+            float t = values[a] / (values[a] - values[b]);
+            Base::Vector3f pos = corners[a] + (corners[b] - corners[a]) * t;
+            result.vertices.emplace_back(key, pos);
+            return std::make_pair(key, pos);
+        };
+
+        // the triangles face to the outer side
+        Base::Vector3f gradient;
+        for (int i = 0; i < numOuter; i++) {
+            gradient += corners[outer[i]] * (1.0F / float(numOuter));
+        }
+        for (int i = 0; i < numInner; i++) {
+            gradient -= corners[inner[i]] * (1.0F / float(numInner));
+        }
+
+        auto addTriangle = [&](const auto& v0, const auto& v1, const auto& v2) {
+            Base::Vector3f normal = (v1.second - v0.second) % (v2.second - v0.second);
+            if (normal * gradient < 0.0F) {
+                result.triangles.push_back({v0.first, v2.first, v1.first});
+            }
+            else {
+                result.triangles.push_back({v0.first, v1.first, v2.first});
+            }
+        };
+
+        if (numInner == 1 || numOuter == 1) {
+            bool single = numInner == 1;
+            int apex = single ? inner[0] : outer[0];
+            const std::array<int, 4>& base = single ? outer : inner;
+            addTriangle(vertex(apex, base[0]), vertex(apex, base[1]), vertex(apex, base[2]));
+        }
+        else {
+            auto v0 = vertex(inner[0], outer[0]);
+            auto v1 = vertex(inner[0], outer[1]);
+            auto v2 = vertex(inner[1], outer[1]);
+            auto v3 = vertex(inner[1], outer[0]);
+            addTriangle(v0, v1, v2);
+            addTriangle(v0, v2, v3);
+        }
+    }
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    const std::vector<Base::Vector3f>& normals;
+    const PointGrid& grid;
+    Base::Vector3f origin;
+    float cellSize;
+    float maxDist;
+};
+
+void reconstruct(
+    const std::vector<Base::Vector3f>& points,
+    const std::vector<Base::Vector3f>& normals,
+    float cellSize,
+    Mesh::MeshObject& mesh
+)
+{
+    // Corners that are farther away from the points have no defined distance
+    const float maxDist = 3.0F * cellSize;
+    PointGrid grid(points, maxDist);
+
+    // The surface cannot leave the region within the maximum distance of the
+    // points, so with this margin all voxels have valid indices
+    const float margin = 5.0F * cellSize;
+    Base::BoundBox3f box = getBoundBox(points);
+    Base::Vector3f origin(box.MinX - margin, box.MinY - margin, box.MinZ - margin);
+    float length = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    if ((length + 2.0F * margin) / cellSize >= float(maxCell)) {
+        throw Base::ValueError("The cell size is too small for the extent of the points");
+    }
+
+    // Start with the voxels that contain points and follow the surface into the
+    // neighbouring voxels. Sheets of the zero level set that don't pass through
+    // a voxel with points are artifacts of the distance function and are skipped.
+    std::vector<uint64_t> frontier;
+    frontier.reserve(points.size());
+    for (const auto& it : points) {
+        Base::Vector3f pos = (it - origin) / cellSize;
+        frontier.push_back(packKey(int64_t(pos.x), int64_t(pos.y), int64_t(pos.z)));
+    }
+    std::sort(frontier.begin(), frontier.end());
+    frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+
+    Polygonizer polygonizer(points, normals, grid, origin, cellSize, maxDist);
+    std::vector<uint64_t> visited;
+    std::vector<Polygonization> results;
+    while (!frontier.empty()) {
+        std::vector<Range> ranges = makeRanges(frontier.size(), 4096);
+        std::size_t offset = results.size();
+        results.resize(offset + ranges.size());
+        QtConcurrent::blockingMap(ranges, [&](Range& range) {
+            Polygonization& result = results[offset + range.index];
+            CornerCache cache;
+            cache.reserve(2 * (range.end - range.begin));
+            for (std::size_t i = range.begin; i < range.end; i++) {
+                polygonizer.polygonize(frontier[i], result, cache);
+            }
+        });
+
+        std::vector<uint64_t> processed;
+        processed.reserve(visited.size() + frontier.size());
+        std::merge(
+            visited.begin(),
+            visited.end(),
+            frontier.begin(),
+            frontier.end(),
+            std::back_inserter(processed)
+        );
+        visited.swap(processed);
+
+        frontier.clear();
+        for (std::size_t i = offset; i < results.size(); i++) {
+            frontier.insert(frontier.end(), results[i].neighbours.begin(), results[i].neighbours.end());
+            std::vector<uint64_t>().swap(results[i].neighbours);
+        }
+        std::sort(frontier.begin(), frontier.end());
+        frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+        frontier.erase(
+            std::remove_if(
+                frontier.begin(),
+                frontier.end(),
+                [&visited](uint64_t key) {
+                    return std::binary_search(visited.begin(), visited.end(), key);
+                }
+            ),
+            frontier.end()
+        );
+    }
+
+    // Merge the vertices that lie on the same edge of the voxel grid
+    std::unordered_map<uint64_t, MeshCore::PointIndex> vertexIndex;
+    MeshCore::MeshPointArray meshPoints;
+    MeshCore::MeshFacetArray meshFacets;
+    for (auto& result : results) {
+        for (const auto& it : result.vertices) {
+            auto index = static_cast<MeshCore::PointIndex>(meshPoints.size());
+            if (vertexIndex.emplace(it.first, index).second) {
+                meshPoints.push_back(MeshCore::MeshPoint(it.second));
+            }
+        }
+        for (const auto& it : result.triangles) {
+            MeshCore::PointIndex p0 = vertexIndex[it[0]];
+            MeshCore::PointIndex p1 = vertexIndex[it[1]];
+            MeshCore::PointIndex p2 = vertexIndex[it[2]];
+            if (p0 != p1 && p1 != p2 && p2 != p0) {
+                meshFacets.push_back(MeshCore::MeshFacet(p0, p1, p2));
+            }
+        }
+        result = Polygonization();
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(meshPoints, meshFacets, true);
+    mesh.swap(kernel);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+PointNormalEstimation::PointNormalEstimation(const Points::PointKernel& pts)
+    : myPoints(pts)
+{}
+
+std::vector<Base::Vector3f> PointNormalEstimation::perform() const
+{
+    std::vector<Base::Vector3f> points = getPoints(myPoints);
+    PointGrid grid(points, neighbourCellSize(points, kSearch));
+    return estimateNormals(points, grid, kSearch);
+}
+
+// ----------------------------------------------------------------------------
+
+SurfaceReconstruction::SurfaceReconstruction(const Points::PointKernel& pts, Mesh::MeshObject& mesh)
+    : myPoints(pts)
+    , myMesh(mesh)
+{}
+
+void SurfaceReconstruction::perform(int ksearch)
+{
+    std::vector<Base::Vector3f> points = getPoints(myPoints);
+    PointGrid grid(points, neighbourCellSize(points, ksearch));
+    std::vector<Base::Vector3f> normals = estimateNormals(points, grid, ksearch);
+
+    float size = float(cellSize);
+    if (size <= 0.0F) {
+        size = 2.0F * averageSpacing(points, grid);
+    }
+    if (size <= 0.0F) {
+        throw Base::ValueError("Cannot determine the cell size from the points");
+    }
+
+    reconstruct(points, normals, size, myMesh);
+}
+
+void SurfaceReconstruction::perform(const std::vector<Base::Vector3f>& normals)
+{
+    if (myPoints.size() != normals.size()) {
+        throw Base::RuntimeError("Number of points doesn't match with number of normals");
+    }
+
+    std::vector<Base::Vector3f> points = getPoints(myPoints);
+    float size = float(cellSize);
+    if (size <= 0.0F) {
+        const int k = 10;
+        PointGrid grid(points, neighbourCellSize(points, k));
+        size = 2.0F * averageSpacing(points, grid);
+    }
+    if (size <= 0.0F) {
+        throw Base::ValueError("Cannot determine the cell size from the points");
+    }
+
+    reconstruct(points, normals, size, myMesh);
+}
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/ReverseEngineering/ReverseEngineeringGlobal.h>
+
+
+namespace Points
+{
+class PointKernel;
+}
+namespace Mesh
+{
+class MeshObject;
+}
+
+namespace Reen
+{
+
+/** Estimates the normals of a point cloud without PCL.
+ * The normal of a point is the direction of least variance of its k nearest
+ * neighbours, which are looked up in a uniform grid. The normals are computed
+ * in parallel. Afterwards they are oriented consistently by propagating the
+ * orientation along a minimum spanning tree of the neighbourhood graph, starting
+ * with a normal that points away from the centre of the cloud.
+ */
+class ReenExport PointNormalEstimation
+{
+public:
+    explicit PointNormalEstimation(const Points::PointKernel&);
+
+    /** \brief Set the number of k nearest neighbours to use for the normal estimation.
+     * \param[in] k the number of k-nearest neighbours
+     */
+    inline void setKSearch(int k)
+    {
+        this->kSearch = k;
+    }
+
+    std::vector<Base::Vector3f> perform() const;
+
+private:
+    const Points::PointKernel& myPoints;
+    int kSearch {10};
+};
+
+/** Reconstructs a mesh from a point cloud without PCL.
+ * The signed distance of the tangent plane of the nearest point (Hoppe et al.)
+ * is sampled at the corners of the voxels around the points. The zero level set
+ * is extracted with marching tetrahedra. The voxels are processed in parallel,
+ * and the result is written directly to the mesh.
+ */
+class ReenExport SurfaceReconstruction
+{
+public:
+    SurfaceReconstruction(const Points::PointKernel&, Mesh::MeshObject&);
+
+    /** \brief Set the edge length of the voxels.
+     * \note If not set, twice the average distance between neighbouring points is used.
+     * \param[in] size the edge length of the voxels
+     */
+    inline void setCellSize(double size)
+    {
+        this->cellSize = size;
+    }
+
+    /** \brief Estimate the normals with k nearest neighbours and reconstruct the surface.
+     * \param[in] k the number of k-nearest neighbours
+     */
+    void perform(int ksearch = 10);
+    /** \brief Pass the normals to the points given in the constructor.
+     * \param[in] normals the normals to the given points.
+     */
+    void perform(const std::vector<Base::Vector3f>& normals);
+
+private:
+    const Points::PointKernel& myPoints;
+    Mesh::MeshObject& myMesh;
+    double cellSize {0.0};
+};
+
+}  // namespace Reen
@@ -27,6 +27,8 @@
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/tokenizer.hpp>
 #include <iomanip>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 
@@ -70,6 +72,51 @@ public:
     }
 };
 
+/**
+ * Return a shared instance of the style set \a style.
+ *
+ * Only a handful of distinct styles are used in a typical sheet, so cells
+ * share one instance per style instead of holding their own copy. The pool
+ * only keeps weak references, a style is freed once no cell uses it any
+ * more. The pool may be used from several threads.
+ *
+ * @param style Set of string describing the style.
+ *
+ * @returns Pointer to the interned style set.
+ *
+ */
+
+static std::shared_ptr<const std::set<std::string>> internStyle(const std::set<std::string>& style)
+{
+    using StylePtr = std::shared_ptr<const std::set<std::string>>;
+    static std::mutex mutex;
+    static std::map<std::set<std::string>, std::weak_ptr<const std::set<std::string>>> pool;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = pool.find(style);
+    if (it != pool.end()) {
+        if (StylePtr shared = it->second.lock()) {
+            return shared;
+        }
+    }
+    else {
+        // New styles are rare, drop the ones that are no longer used
+        for (auto jt = pool.begin(); jt != pool.end();) {
+            if (jt->second.expired()) {
+                jt = pool.erase(jt);
+            }
+            else {
+                ++jt;
+            }
+        }
+        it = pool.emplace(style, StylePtr()).first;
+    }
+
+    auto shared = std::make_shared<const std::set<std::string>>(style);
+    it->second = shared;
+    return shared;
+}
+
 ///////////////////////////////////////////////////////////
 
 // clang-format off
@@ -152,7 +199,7 @@ Cell& Cell::operator=(const Cell& rhs)
 
     setExpression(App::ExpressionPtr(rhs.expression ? rhs.expression->copy() : nullptr));
     setAlignment(rhs.alignment);
-    setStyle(rhs.style);
+    setStyle(rhs.getStyleSet());
     setBackground(rhs.backgroundColor);
     setForeground(rhs.foregroundColor);
     setDisplayUnit(rhs.displayUnit.stringRep);
@@ -438,11 +485,11 @@ bool Cell::getAlignment(int& _alignment) const
 
 void Cell::setStyle(const std::set<std::string>& _style)
 {
-    if (_style != style) {
+    if (_style != getStyleSet()) {
         PropertySheet::AtomicPropertyChange signaller(*owner);
 
-        style = _style;
-        setUsed(STYLE_SET, !style.empty());
+        style = _style.empty() ? nullptr : internStyle(_style);
+        setUsed(STYLE_SET, !_style.empty());
         setDirty();
 
         signaller.tryInvoke();
@@ -456,10 +503,16 @@ void Cell::setStyle(const std::set<std::string>& _style)
 
 bool Cell::getStyle(std::set<std::string>& _style) const
 {
-    _style = style;
+    _style = getStyleSet();
     return isUsed(STYLE_SET);
 }
 
+const std::set<std::string>& Cell::getStyleSet() const
+{
+    static const std::set<std::string> noStyle;
+    return style ? *style : noStyle;
+}
+
 /**
  * Set foreground (i.e text) color of the cell to \a color.
  *
@@ -873,7 +926,7 @@ void Cell::save(std::ostream& os, const char* indent, bool noContent) const
     }
 
     if (isUsed(STYLE_SET)) {
-        os << "style=\"" << encodeStyle(style) << "\" ";
+        os << "style=\"" << encodeStyle(getStyleSet()) << "\" ";
     }
 
     if (isUsed(FOREGROUND_COLOR_SET)) {
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <memory>
 #include <set>
 #include <string>
 
@@ -177,6 +178,8 @@ private:
 
     bool isUsed(int mask) const;
 
+    const std::set<std::string>& getStyleSet() const;
+
     void freeze();
 
     void unfreeze();
@@ -202,7 +205,8 @@ private:
     int used;
     mutable App::ExpressionPtr expression;
     int alignment;
-    std::set<std::string> style;
+    /*! Shared, interned style set or null if no style is set */
+    std::shared_ptr<const std::set<std::string>> style;
     Base::Color foregroundColor;
     Base::Color backgroundColor;
     DisplayUnit displayUnit;
@@ -712,6 +712,49 @@ void PropertySheet::setContent(CellAddress address, const char* value)
     cell->setContent(value);
 }
 
+/**
+ * Set the content of many cells in one go.
+ *
+ * Only one change notification is emitted for the whole batch. Cells given in
+ * ascending (row-major) order are appended to the cell map without a lookup,
+ * which makes bulk imports of large tables linear in the number of cells.
+ *
+ * @param contents List of cell addresses and their content.
+ *
+ */
+
+void PropertySheet::setContents(const std::vector<std::pair<CellAddress, std::string>>& contents)
+{
+    AtomicPropertyChange signaller(*this);
+
+    for (const auto& [address, content] : contents) {
+        if (content.empty()) {
+            // Same as Sheet::setCell(), an empty value clears the cell
+            if (owner && this == &owner->cells) {
+                owner->clear(address);
+            }
+            else {
+                clear(address);
+            }
+            continue;
+        }
+        Cell* cell = nullptr;
+        if (mergedCells.empty()) {
+            auto it = data.emplace_hint(data.end(), address, nullptr);
+            if (!it->second) {
+                it->second = new Cell(address, this);
+            }
+            cell = it->second;
+        }
+        else {
+            cell = nonNullCellAt(address);
+        }
+        cell->setContent(content.c_str());
+    }
+
+    signaller.tryInvoke();
+}
+
 void PropertySheet::setAlignment(CellAddress address, int _alignment)
 {
     Cell* cell = nonNullCellAt(address);
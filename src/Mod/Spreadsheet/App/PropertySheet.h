@@ -111,6 +111,8 @@ public:
 
     void setContent(App::CellAddress address, const char* value);
 
+    void setContents(const std::vector<std::pair<App::CellAddress, std::string>>& contents);
+
     void setAlignment(App::CellAddress address, int _alignment);
 
     void setStyle(App::CellAddress address, const std::set<std::string>& _style);
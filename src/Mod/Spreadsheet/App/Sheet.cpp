@@ -230,33 +230,36 @@ bool Sheet::importFromFile(const std::string& filename, char delimiter, char quo
 
     if (file.is_open()) {
         std::string line;
+        // Collected in row-major order, so the cells can be created in one batch
+        std::vector<std::pair<CellAddress, std::string>> contents;
 
-        while (std::getline(file, line)) {
-            using namespace boost;
+        using namespace boost;
+
+        escaped_list_separator<char> e;
+        if (quoteChar) {
+            e = escaped_list_separator<char>(escapeChar, delimiter, quoteChar);
+        }
+        else {
+            e = escaped_list_separator<char>('\0', delimiter, '\0');
+        }
 
+        while (std::getline(file, line)) {
             try {
-                escaped_list_separator<char> e;
                 int col = 0;
 
-                if (quoteChar) {
-                    e = escaped_list_separator<char>(escapeChar, delimiter, quoteChar);
-                }
-                else {
-                    e = escaped_list_separator<char>('\0', delimiter, '\0');
-                }
-
                 tokenizer<escaped_list_separator<char>> tok(line, e);
 
                 for (tokenizer<escaped_list_separator<char>>::iterator i = tok.begin();
                      i != tok.end();
                      ++i) {
                     if (!i->empty()) {
-                        setCell(CellAddress(row, col), (*i).c_str());
+                        contents.emplace_back(CellAddress(row, col), *i);
                     }
                     col++;
                 }
             }
             catch (...) {
+                cells.setContents(contents);
                 signaller.tryInvoke();
                 return false;
             }
@@ -264,6 +267,7 @@ bool Sheet::importFromFile(const std::string& filename, char delimiter, char quo
             ++row;
         }
         file.close();
+        cells.setContents(contents);
         signaller.tryInvoke();
         return true;
     }
@@ -321,36 +325,38 @@ bool Sheet::exportToFile(const std::string& filename, char delimiter, char quote
         return false;
     }
 
-    auto usedCells = cells.getNonEmptyCells();
-    auto i = usedCells.begin();
+    auto values = getCellValues();
+    // The whole table is formatted first and written at once
+    std::ostringstream out;
 
-    while (i != usedCells.end()) {
-        Property* prop = getProperty(*i);
+    for (auto i = values.begin(); i != values.end(); ++i) {
+        const CellAddress& address = i->first;
+        const Property* prop = i->second;
 
-        if (prevRow != -1 && prevRow != i->row()) {
-            for (int j = prevRow; j < i->row(); ++j) {
-                file << std::endl;
+        if (prevRow != -1 && prevRow != address.row()) {
+            for (int j = prevRow; j < address.row(); ++j) {
+                out << '\n';
             }
-            prevCol = usedCells.begin()->col();
+            prevCol = values.begin()->first.col();
         }
-        if (prevCol != -1 && i->col() != prevCol) {
-            for (int j = prevCol; j < i->col(); ++j) {
-                file << delimiter;
+        if (prevCol != -1 && address.col() != prevCol) {
+            for (int j = prevCol; j < address.col(); ++j) {
+                out << delimiter;
             }
         }
 
         std::stringstream field;
 
-        if (auto p = freecad_cast<PropertyQuantity*>(prop)) {
+        if (auto p = freecad_cast<const PropertyQuantity*>(prop)) {
             field << p->getValue();
         }
-        else if (auto p = freecad_cast<PropertyFloat*>(prop)) {
+        else if (auto p = freecad_cast<const PropertyFloat*>(prop)) {
             field << p->getValue();
         }
-        else if (auto p = freecad_cast<PropertyInteger*>(prop)) {
+        else if (auto p = freecad_cast<const PropertyInteger*>(prop)) {
             field << p->getValue();
         }
-        else if (auto p = freecad_cast<PropertyString*>(prop)) {
+        else if (auto p = freecad_cast<const PropertyString*>(prop)) {
             field << p->getValue();
         }
         else {
@@ -360,20 +366,48 @@ bool Sheet::exportToFile(const std::string& filename, char delimiter, char quote
         std::string str = field.str();
 
         if (quoteChar && str.find_first_of(std::string(quoteChar, delimiter)) != std::string::npos) {
-            writeEscaped(str, quoteChar, escapeChar, file);
+            writeEscaped(str, quoteChar, escapeChar, out);
         }
         else {
-            file << str;
+            out << str;
         }
 
-        prevRow = i->row();
-        prevCol = i->col();
-        ++i;
+        prevRow = address.row();
+        prevCol = address.col();
     }
-    file << std::endl;
+    out << '\n';
+    file << out.str();
     file.close();
 
-    return true;
+    return !file.fail();
+}
+
+/**
+ * Get the value properties of all non-empty cells.
+ *
+ * The properties are looked up in one pass instead of by the name of each
+ * cell, e.g. to export the whole sheet.
+ *
+ * @returns Pairs of cell address and value property in row-major order. The
+ * property is null for a cell that has no value yet.
+ *
+ */
+
+std::vector<std::pair<CellAddress, const Property*>> Sheet::getCellValues() const
+{
+    std::map<CellAddress, const Property*> valueProps;
+    for (const auto& [prop, address] : propAddress) {
+        valueProps.emplace(address, prop);
+    }
+
+    std::vector<std::pair<CellAddress, const Property*>> values;
+    auto usedCells = cells.getNonEmptyCells();
+    values.reserve(usedCells.size());
+    for (const auto& address : usedCells) {
+        auto it = valueProps.find(address);
+        values.emplace_back(address, it != valueProps.end() ? it->second : nullptr);
+    }
+    return values;
 }
 
 /**
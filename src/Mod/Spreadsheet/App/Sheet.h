@@ -104,6 +104,8 @@ public:
         char escapeChar = '\\'
     ) const;
 
+    std::vector<std::pair<App::CellAddress, const App::Property*>> getCellValues() const;
+
     bool mergeCells(const App::Range& range);
 
     void splitCell(App::CellAddress address);
@@ -0,0 +1,105 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# **************************************************************************/
+
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import unittest
+
+import FreeCAD
+
+
+def consoleExecutable():
+    name = "FreeCADCmd.exe" if sys.platform == "win32" else "FreeCADCmd"
+    return os.path.join(FreeCAD.getHomePath(), "bin", name)
+
+
+@unittest.skipUnless(os.path.exists(consoleExecutable()), "FreeCADCmd not found")
+class TestBatchMode(unittest.TestCase):
+    """Runs the jobs of a job file with --batch in worker processes"""
+
+    def setUp(self):
+        self.tempDir = tempfile.TemporaryDirectory()
+        self.files = []
+        for name in ("first.FCStd", "with;semicolon.FCStd"):
+            doc = FreeCAD.newDocument("BatchMode")
+            doc.addObject("App::FeatureTest", "Feature")
+            path = os.path.join(self.tempDir.name, name)
+            doc.saveAs(path)
+            FreeCAD.closeDocument(doc.Name)
+            self.files.append(path)
+
+    def tearDown(self):
+        self.tempDir.cleanup()
+
+    def runBatch(self, jobs, workers):
+        jobFile = os.path.join(self.tempDir.name, "jobs.txt")
+        report = os.path.join(self.tempDir.name, "report.json")
+        with open(jobFile, "w", encoding="utf-8") as f:
+            f.write("# batch test\n")
+            for job in jobs:
+                f.write('"{}"\n'.format(job.replace('"', '""')))
+        proc = subprocess.run(
+            [
+                consoleExecutable(),
+                "--batch",
+                jobFile,
+                "--batch-jobs",
+                str(workers),
+                "--batch-report",
+                report,
+            ],
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL,
+            timeout=600,
+        )
+        with open(report, encoding="utf-8") as f:
+            return proc.returncode, json.load(f)
+
+    def testWorkersRunSeveralJobs(self):
+        missing = os.path.join(self.tempDir.name, "missing.FCStd")
+        jobs = [self.files[0], missing, self.files[1], self.files[0], self.files[1]]
+
+        code, report = self.runBatch(jobs, 2)
+
+        # the failed job makes the whole run fail
+        self.assertNotEqual(code, 0)
+        self.assertEqual(report["jobs"], len(jobs))
+        self.assertEqual(report["workers"], 2)
+        self.assertEqual(report["failed"], 1)
+        # the results are in the order of the jobs, whatever worker finished first
+        results = report["results"]
+        self.assertEqual([result["input"] for result in results], jobs)
+        self.assertEqual(
+            [result["success"] for result in results], [True, False, True, True, True]
+        )
+        self.assertTrue(results[1]["error"])
+
+    def testAllJobsSucceed(self):
+        code, report = self.runBatch(self.files, 1)
+
+        self.assertEqual(code, 0)
+        self.assertEqual(report["succeeded"], len(self.files))
+        for result in report["results"]:
+            self.assertGreater(result["seconds"], 0.0)
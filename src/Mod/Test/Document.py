@@ -430,6 +430,28 @@ class DocumentBasicCases(unittest.TestCase):
         for i in obj2.OutList:
             self.assertEqual(obj2.getSubObject(i.Name + ".", retType=1).Name, i.Name)
 
+    def testSubObjectsCached(self):
+        part = self.Doc.addObject("App::Part", "Part")
+        feature = self.Doc.addObject("App::FeatureTest", "Feature")
+        part.addObject(feature)
+        part.Placement.Base = FreeCAD.Vector(1, 2, 3)
+
+        res = part.getSubObjectsCached(["Feature.Face1", "Missing.", "Feature."])
+        self.assertEqual(len(res), 3)
+        self.assertEqual(res[0][0].Name, "Feature")
+        self.assertEqual(res[0][1], part.getSubObject("Feature.", retType=4))
+        self.assertEqual(res[0][2], "Face1")
+        self.assertIsNone(res[1][0])
+        self.assertEqual(res[2][2], "")
+
+        # a second call gives the cached results, a moved part is seen
+        part.Placement.Base = FreeCAD.Vector(4, 5, 6)
+        res = part.getSubObjectsCached(("Feature.",), transform=True)
+        self.assertEqual(res[0][1].A[3], 4)
+        res = part.getSubObjectsCached(("Feature.",), transform=False)
+        self.assertEqual(res[0][1], FreeCAD.Matrix())
+        self.assertRaises(TypeError, part.getSubObjectsCached, "Feature.")
+
     def testExtensions(self):
         # we try to create a normal python object and add an extension to it
         obj = self.Doc.addObject("App::DocumentObject", "Extension_1")
@@ -30,6 +30,7 @@ FreeCAD.__unit_test__ += [
     "Document",
     "Metadata",
     "StringHasher",
+    "BatchMode",
     "UnicodeTests",
     "TestPythonSyntax",
     "TestCoinNodeSnapshots",
@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <numbers>
+#include <random>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/TopoAlgorithm.h>
+
+// Run with --benchmark_format=json or --benchmark_out=<file> to get machine readable results.
+// Set FC_BENCHMARK_LARGE to also run the 10M facets meshes.
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+enum class Shape
+{
+    Sphere,
+    Torus,
+    Scan,
+};
+
+const char* shapeName(Shape shape)
+{
+    switch (shape) {
+        case Shape::Sphere:
+            return "sphere";
+        case Shape::Torus:
+            return "torus";
+        case Shape::Scan:
+            return "scan";
+    }
+    return "";
+}
+
+// Uniform value in [0, 1) that does not depend on the standard library implementation
+float uniform(std::mt19937& gen)
+{
+    return static_cast<float>(static_cast<double>(gen()) / 4294967296.0);
+}
+
+// UV sphere of about the given number of facets. The scan surrogate is the same sphere with
+// radial noise on every point.
+std::pair<MeshCore::MeshPointArray, MeshCore::MeshFacetArray> makeSphere(long facets, bool noise)
+{
+    const auto rings = std::max<long>(3, std::lround(std::sqrt(facets / 4.0)));
+    const auto segments = 2 * rings;
+    std::mt19937 gen(42);
+
+    MeshCore::MeshPointArray points;
+    points.reserve(segments * (rings - 1) + 2);
+    points.emplace_back(0.0F, 0.0F, 1.0F);
+    for (long i = 1; i < rings; ++i) {
+        double theta = std::numbers::pi * i / rings;
+        for (long j = 0; j < segments; ++j) {
+            double phi = 2.0 * std::numbers::pi * j / segments;
+            double radius = noise ? 1.0 + 0.01 * (uniform(gen) - 0.5) : 1.0;
+            points.emplace_back(
+                static_cast<float>(radius * std::sin(theta) * std::cos(phi)),
+                static_cast<float>(radius * std::sin(theta) * std::sin(phi)),
+                static_cast<float>(radius * std::cos(theta))
+            );
+        }
+    }
+    points.emplace_back(0.0F, 0.0F, -1.0F);
+
+    auto index = [segments](long ring, long segment) {
+        return static_cast<MeshCore::PointIndex>(1 + (ring - 1) * segments + segment % segments);
+    };
+    const auto south = static_cast<MeshCore::PointIndex>(points.size() - 1);
+
+    MeshCore::MeshFacetArray faces;
+    faces.reserve(2 * segments * (rings - 1));
+    for (long j = 0; j < segments; ++j) {
+        faces.emplace_back(0, index(1, j), index(1, j + 1));
+        faces.emplace_back(index(rings - 1, j), south, index(rings - 1, j + 1));
+    }
+    for (long i = 1; i < rings - 1; ++i) {
+        for (long j = 0; j < segments; ++j) {
+            faces.emplace_back(index(i, j), index(i + 1, j), index(i + 1, j + 1));
+            faces.emplace_back(index(i, j), index(i + 1, j + 1), index(i, j + 1));
+        }
+    }
+    return {std::move(points), std::move(faces)};
+}
+
+// Torus of about the given number of facets
+std::pair<MeshCore::MeshPointArray, MeshCore::MeshFacetArray> makeTorus(long facets)
+{
+    const auto tube = std::max<long>(3, std::lround(std::sqrt(facets / 4.0)));
+    const auto ring = 2 * tube;
+    const double major = 3.0;
+    const double minor = 1.0;
+
+    MeshCore::MeshPointArray points;
+    points.reserve(ring * tube);
+    for (long u = 0; u < ring; ++u) {
+        double alpha = 2.0 * std::numbers::pi * u / ring;
+        for (long v = 0; v < tube; ++v) {
+            double beta = 2.0 * std::numbers::pi * v / tube;
+            points.emplace_back(
+                static_cast<float>((major + minor * std::cos(beta)) * std::cos(alpha)),
+                static_cast<float>((major + minor * std::cos(beta)) * std::sin(alpha)),
+                static_cast<float>(minor * std::sin(beta))
+            );
+        }
+    }
+
+    auto index = [ring, tube](long u, long v) {
+        return static_cast<MeshCore::PointIndex>((u % ring) * tube + v % tube);
+    };
+
+    MeshCore::MeshFacetArray faces;
+    faces.reserve(2 * ring * tube);
+    for (long u = 0; u < ring; ++u) {
+        for (long v = 0; v < tube; ++v) {
+            faces.emplace_back(index(u, v), index(u + 1, v), index(u + 1, v + 1));
+            faces.emplace_back(index(u, v), index(u + 1, v + 1), index(u, v + 1));
+        }
+    }
+    return {std::move(points), std::move(faces)};
+}
+
+std::pair<MeshCore::MeshPointArray, MeshCore::MeshFacetArray> makeArrays(Shape shape, long facets)
+{
+    switch (shape) {
+        case Shape::Sphere:
+            return makeSphere(facets, false);
+        case Shape::Torus:
+            return makeTorus(facets);
+        case Shape::Scan:
+            return makeSphere(facets, true);
+    }
+    return {};
+}
+
+// Meshes are generated once per shape and size and shared by all benchmarks
+const MeshCore::MeshKernel& getMesh(Shape shape, long facets)
+{
+    static std::map<std::pair<Shape, long>, MeshCore::MeshKernel> meshes;
+    auto key = std::make_pair(shape, facets);
+    auto it = meshes.find(key);
+    if (it == meshes.end()) {
+        auto [points, faces] = makeArrays(shape, facets);
+        it = meshes.emplace(key, MeshCore::MeshKernel()).first;
+        it->second.Adopt(points, faces, true);
+    }
+    return it->second;
+}
+
+void setUp(benchmark::State& state, const MeshCore::MeshKernel& mesh)
+{
+    state.SetLabel(shapeName(static_cast<Shape>(state.range(0))));
+    state.counters["facets"] = static_cast<double>(mesh.CountFacets());
+    state.counters["facets_per_second"] = benchmark::Counter(
+        static_cast<double>(mesh.CountFacets()),
+        benchmark::Counter::kIsIterationInvariantRate
+    );
+}
+
+// Arguments are the shape and the approximate number of facets
+void meshArguments(benchmark::internal::Benchmark* bench, long maxFacets)
+{
+    std::vector<long> sizes {10'000, 100'000, 1'000'000};
+    if (std::getenv("FC_BENCHMARK_LARGE")) {
+        sizes.push_back(10'000'000);
+    }
+    for (auto shape : {Shape::Sphere, Shape::Torus, Shape::Scan}) {
+        for (auto size : sizes) {
+            if (size <= maxFacets) {
+                bench->Args({static_cast<long>(shape), size});
+            }
+        }
+    }
+    bench->ArgNames({"shape", "facets"});
+    bench->Unit(benchmark::kMillisecond);
+}
+
+void allSizes(benchmark::internal::Benchmark* bench)
+{
+    meshArguments(bench, std::numeric_limits<long>::max());
+}
+
+// For the algorithms that are too slow to be run on the largest meshes
+void upToOneMillion(benchmark::internal::Benchmark* bench)
+{
+    meshArguments(bench, 1'000'000);
+}
+
+}  // namespace
+
+static void MeshKernel_Adopt(benchmark::State& state)
+{
+    auto shape = static_cast<Shape>(state.range(0));
+    const auto& mesh = getMesh(shape, state.range(1));
+    setUp(state, mesh);
+    for (auto _ : state) {
+        state.PauseTiming();
+        MeshCore::MeshPointArray points = mesh.GetPoints();
+        MeshCore::MeshFacetArray faces = mesh.GetFacets();
+        MeshCore::MeshKernel kernel;
+        state.ResumeTiming();
+        kernel.Adopt(points, faces, true);
+        benchmark::DoNotOptimize(kernel.CountFacets());
+    }
+}
+BENCHMARK(MeshKernel_Adopt)->Apply(allSizes);
+
+static void MeshKernel_Volume(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mesh.GetVolume());
+    }
+}
+BENCHMARK(MeshKernel_Volume)->Apply(allSizes);
+
+static void MeshFacetGrid_Build(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    for (auto _ : state) {
+        MeshCore::MeshFacetGrid grid(mesh);
+        benchmark::DoNotOptimize(grid.GetCtElements(0, 0, 0));
+    }
+}
+BENCHMARK(MeshFacetGrid_Build)->Apply(allSizes);
+
+static void MeshAlgorithm_NearestFacetOnRay(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    MeshCore::MeshFacetGrid grid(mesh);
+    MeshCore::MeshAlgorithm algo(mesh);
+
+    // Rays from points on a Fibonacci sphere towards the origin
+    const int numRays = 1000;
+    const double golden = std::numbers::pi * (3.0 - std::sqrt(5.0));
+    std::vector<Base::Vector3f> directions;
+    for (int i = 0; i < numRays; ++i) {
+        double z = 1.0 - 2.0 * (i + 0.5) / numRays;
+        double r = std::sqrt(1.0 - z * z);
+        directions.emplace_back(
+            static_cast<float>(r * std::cos(golden * i)),
+            static_cast<float>(r * std::sin(golden * i)),
+            static_cast<float>(z)
+        );
+    }
+
+    for (auto _ : state) {
+        for (const auto& dir : directions) {
+            Base::Vector3f res;
+            MeshCore::FacetIndex facet {};
+            benchmark::DoNotOptimize(algo.NearestFacetOnRay(dir * 5.0F, -dir, grid, res, facet));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numRays);
+}
+BENCHMARK(MeshAlgorithm_NearestFacetOnRay)->Apply(allSizes);
+
+static void MeshEvalSolid_Evaluate(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    for (auto _ : state) {
+        MeshCore::MeshEvalSolid eval(mesh);
+        benchmark::DoNotOptimize(eval.Evaluate());
+    }
+}
+BENCHMARK(MeshEvalSolid_Evaluate)->Apply(allSizes);
+
+static void MeshTopoAlgorithm_HarmonizeNormals(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    for (auto _ : state) {
+        state.PauseTiming();
+        MeshCore::MeshKernel kernel(mesh);
+        state.ResumeTiming();
+        MeshCore::MeshTopoAlgorithm topo(kernel);
+        topo.HarmonizeNormals();
+    }
+}
+BENCHMARK(MeshTopoAlgorithm_HarmonizeNormals)->Apply(allSizes);
+
+static void MeshSimplify_Half(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    for (auto _ : state) {
+        state.PauseTiming();
+        MeshCore::MeshKernel kernel(mesh);
+        state.ResumeTiming();
+        MeshCore::MeshSimplify simplify(kernel);
+        simplify.simplify(static_cast<int>(mesh.CountFacets() / 2));
+    }
+}
+BENCHMARK(MeshSimplify_Half)->Apply(upToOneMillion);
+
+static void MeshOutput_SaveBinarySTL(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    for (auto _ : state) {
+        std::stringstream str;
+        MeshCore::MeshOutput output(mesh);
+        benchmark::DoNotOptimize(output.SaveBinarySTL(str));
+    }
+}
+BENCHMARK(MeshOutput_SaveBinarySTL)->Apply(allSizes);
+
+static void MeshInput_LoadBinarySTL(benchmark::State& state)
+{
+    const auto& mesh = getMesh(static_cast<Shape>(state.range(0)), state.range(1));
+    setUp(state, mesh);
+    std::stringstream stl;
+    MeshCore::MeshOutput(mesh).SaveBinarySTL(stl);
+    const std::string data = stl.str();
+    for (auto _ : state) {
+        std::istringstream str(data);
+        MeshCore::MeshKernel kernel;
+        MeshCore::MeshInput input(kernel);
+        benchmark::DoNotOptimize(input.LoadBinarySTL(str));
+    }
+}
+BENCHMARK(MeshInput_LoadBinarySTL)->Apply(allSizes);
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
+
+BENCHMARK_MAIN();
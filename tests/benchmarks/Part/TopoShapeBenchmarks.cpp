@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <initializer_list>
+#include <numbers>
+#include <vector>
+
+#include <src/App/InitApplication.h>
+
+#include <App/StringHasher.h>
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/Part/App/WireJoiner.h>
+
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <TopoDS.hxx>
+#include <gp.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Pnt.hxx>
+
+// Every workload runs in three modes so that the cost of topological naming can be told apart
+// from the OCCT algorithm:
+//   mode 0: untagged input shapes, no element map is generated
+//   mode 1: tagged input shapes, element maps are generated
+//   mode 2: as mode 1, and the element names are hashed with a StringHasher
+// Run with --benchmark_format=json or --benchmark_out=<file> to get machine readable results.
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using Part::TopoShape;
+
+namespace
+{
+
+enum class Mode
+{
+    NoElementMap,
+    ElementMap,
+    ElementMapHasher,
+};
+
+const char* modeName(Mode mode)
+{
+    switch (mode) {
+        case Mode::NoElementMap:
+            return "no element map";
+        case Mode::ElementMap:
+            return "element map";
+        case Mode::ElementMapHasher:
+            return "element map + hasher";
+    }
+    return "";
+}
+
+struct Context
+{
+    explicit Context(const benchmark::State& state)
+        : mode(static_cast<Mode>(state.range(0)))
+        , size(state.range(1))
+    {
+        if (mode == Mode::ElementMapHasher) {
+            hasher = App::StringHasherRef(new App::StringHasher);
+        }
+    }
+
+    // Input shapes get a unique tag unless the element maps are disabled
+    TopoShape input(const TopoDS_Shape& shape)
+    {
+        if (mode == Mode::NoElementMap) {
+            return {shape};
+        }
+        return {shape, ++tag, hasher};
+    }
+
+    std::vector<TopoShape> inputs(const std::vector<TopoDS_Shape>& shapes)
+    {
+        std::vector<TopoShape> res;
+        res.reserve(shapes.size());
+        for (const auto& shape : shapes) {
+            res.push_back(input(shape));
+        }
+        return res;
+    }
+
+    TopoShape result() const
+    {
+        return {0, hasher};
+    }
+
+    void report(benchmark::State& state, const TopoShape& shape) const
+    {
+        state.SetLabel(modeName(mode));
+        state.counters["element_map_size"] = static_cast<double>(shape.getElementMapSize());
+        state.counters["hasher_size"] = hasher.isNull() ? 0.0 : static_cast<double>(hasher->size());
+    }
+
+    Mode mode;
+    long size;
+    long tag {0};
+    App::StringHasherRef hasher;
+};
+
+void modesAndSizes(benchmark::internal::Benchmark* bench, std::initializer_list<long> sizes)
+{
+    for (auto mode : {Mode::NoElementMap, Mode::ElementMap, Mode::ElementMapHasher}) {
+        for (auto size : sizes) {
+            bench->Args({static_cast<long>(mode), size});
+        }
+    }
+    bench->ArgNames({"mode", "size"});
+    bench->Unit(benchmark::kMillisecond);
+}
+
+void chainSizes(benchmark::internal::Benchmark* bench)
+{
+    modesAndSizes(bench, {10, 40});
+}
+
+void manySizes(benchmark::internal::Benchmark* bench)
+{
+    modesAndSizes(bench, {1000, 10000});
+}
+
+void gridSizes(benchmark::internal::Benchmark* bench)
+{
+    modesAndSizes(bench, {5, 20});
+}
+
+// A plate of size x 2 x 1 with size cylinders along its length
+TopoDS_Shape makePlate(long size)
+{
+    return BRepPrimAPI_MakeBox(gp_Pnt(0, 0, 0), 2.0 * size, 2.0, 1.0).Shape();
+}
+
+std::vector<TopoDS_Shape> makeHoleTools(long size)
+{
+    std::vector<TopoDS_Shape> tools;
+    for (long i = 0; i < size; ++i) {
+        gp_Ax2 axis(gp_Pnt(1.0 + 2.0 * i, 1.0, -1.0), gp::DZ());
+        tools.push_back(BRepPrimAPI_MakeCylinder(axis, 0.5, 3.0).Shape());
+    }
+    return tools;
+}
+
+}  // namespace
+
+// Fuse a row of overlapping cubes one at a time
+static void TopoShape_FuseChain(benchmark::State& state)
+{
+    Context ctx(state);
+    std::vector<TopoDS_Shape> cubes;
+    for (long i = 0; i < ctx.size; ++i) {
+        cubes.push_back(BRepPrimAPI_MakeBox(gp_Pnt(0.5 * i, 0.1 * i, 0), 1.0, 1.0, 1.0).Shape());
+    }
+    auto inputs = ctx.inputs(cubes);
+
+    TopoShape shape;
+    for (auto _ : state) {
+        shape = inputs.front();
+        for (size_t i = 1; i < inputs.size(); ++i) {
+            shape = ctx.result().makeElementFuse({shape, inputs[i]});
+        }
+    }
+    ctx.report(state, shape);
+}
+BENCHMARK(TopoShape_FuseChain)->Apply(chainSizes);
+
+// Drill holes into a plate one at a time
+static void TopoShape_CutChain(benchmark::State& state)
+{
+    Context ctx(state);
+    auto plate = ctx.input(makePlate(ctx.size));
+    auto tools = ctx.inputs(makeHoleTools(ctx.size));
+
+    TopoShape shape;
+    for (auto _ : state) {
+        shape = plate;
+        for (const auto& tool : tools) {
+            shape = ctx.result().makeElementCut({shape, tool});
+        }
+    }
+    ctx.report(state, shape);
+}
+BENCHMARK(TopoShape_CutChain)->Apply(chainSizes);
+
+// Fillet the rims of all holes of a drilled plate
+static void TopoShape_FilletEdges(benchmark::State& state)
+{
+    Context ctx(state);
+    auto tools = ctx.result().makeElementCompound(ctx.inputs(makeHoleTools(ctx.size)));
+    auto drilled = ctx.result().makeElementCut({ctx.input(makePlate(ctx.size)), tools});
+    std::vector<TopoShape> edges;
+    for (const auto& edge : drilled.getSubTopoShapes(TopAbs_EDGE)) {
+        if (BRepAdaptor_Curve(TopoDS::Edge(edge.getShape())).GetType() == GeomAbs_Circle) {
+            edges.push_back(edge);
+        }
+    }
+
+    TopoShape shape;
+    for (auto _ : state) {
+        shape = ctx.result().makeElementFillet(drilled, edges, 0.1, 0.1);
+    }
+    state.counters["edges"] = static_cast<double>(edges.size());
+    ctx.report(state, shape);
+}
+BENCHMARK(TopoShape_FilletEdges)->Apply(chainSizes);
+
+// Compound of many separate solids
+static void TopoShape_Compound(benchmark::State& state)
+{
+    Context ctx(state);
+    std::vector<TopoDS_Shape> boxes;
+    for (long i = 0; i < ctx.size; ++i) {
+        gp_Pnt corner(2.0 * (i % 100), 2.0 * (i / 100), 0.0);
+        boxes.push_back(BRepPrimAPI_MakeBox(corner, 1.0, 1.0, 1.0).Shape());
+    }
+    auto inputs = ctx.inputs(boxes);
+
+    TopoShape shape;
+    for (auto _ : state) {
+        shape = ctx.result().makeElementCompound(inputs);
+    }
+    ctx.report(state, shape);
+}
+BENCHMARK(TopoShape_Compound)->Apply(manySizes);
+
+// Connect the edges of a polygon given in scrambled order
+static void TopoShape_MakeElementWires(benchmark::State& state)
+{
+    Context ctx(state);
+    auto point = [&ctx](long i) {
+        double angle = 2.0 * std::numbers::pi * i / ctx.size;
+        return gp_Pnt(std::cos(angle), std::sin(angle), 0.0);
+    };
+    std::vector<TopoDS_Shape> edges;
+    for (long i = 0; i < ctx.size; ++i) {
+        // 7919 is a prime, so this visits every edge once for the sizes used below
+        long k = (i * 7919) % ctx.size;
+        edges.push_back(BRepBuilderAPI_MakeEdge(point(k), point(k + 1)).Edge());
+    }
+    auto inputs = ctx.inputs(edges);
+
+    TopoShape shape;
+    for (auto _ : state) {
+        shape = ctx.result().makeElementWires(inputs);
+    }
+    ctx.report(state, shape);
+}
+BENCHMARK(TopoShape_MakeElementWires)->Apply(manySizes);
+
+// Split and join a grid of crossing lines into closed wires
+static void WireJoiner_Grid(benchmark::State& state)
+{
+    Context ctx(state);
+    std::vector<TopoDS_Shape> lines;
+    for (long i = 0; i <= ctx.size; ++i) {
+        double pos = static_cast<double>(i);
+        lines.push_back(BRepBuilderAPI_MakeEdge(gp_Pnt(pos, 0, 0), gp_Pnt(pos, ctx.size, 0)).Edge());
+        lines.push_back(BRepBuilderAPI_MakeEdge(gp_Pnt(0, pos, 0), gp_Pnt(ctx.size, pos, 0)).Edge());
+    }
+    auto inputs = ctx.inputs(lines);
+
+    TopoShape shape;
+    for (auto _ : state) {
+        Part::WireJoiner joiner;
+        joiner.setSplitEdges(true);
+        joiner.addShape(inputs);
+        shape = ctx.result();
+        joiner.getResultWires(shape);
+    }
+    ctx.report(state, shape);
+}
+BENCHMARK(WireJoiner_Grid)->Apply(gridSizes);
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
+
+int main(int argc, char** argv)
+{
+    tests::initApplication();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <App/Application.h>
+#include <App/BatchRunner.h>
+#include <App/Document.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+
+class BatchRunnerTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+};
+
+TEST_F(BatchRunnerTest, readJobs)
+{
+    // Arrange
+    std::istringstream str(
+        "# comment\n"
+        "\n"
+        "  first.FCStd ; first.step;first.stl  \n"
+        "second.FCStd\n"
+        "\"a;b.FCStd\" ; \" c \"\"d\"\".step\"\n"
+    );
+
+    // Act
+    auto jobs = App::BatchRunner::readJobs(str);
+
+    // Assert
+    ASSERT_EQ(jobs.size(), 3);
+    EXPECT_EQ(jobs[0].input, "first.FCStd");
+    EXPECT_EQ(jobs[0].outputs, (std::vector<std::string> {"first.step", "first.stl"}));
+    EXPECT_EQ(jobs[1].input, "second.FCStd");
+    EXPECT_TRUE(jobs[1].outputs.empty());
+    // Quoted names keep ';', spaces and doubled quotes
+    EXPECT_EQ(jobs[2].input, "a;b.FCStd");
+    EXPECT_EQ(jobs[2].outputs, (std::vector<std::string> {" c \"d\".step"}));
+}
+
+TEST_F(BatchRunnerTest, readJobsMissingQuote)
+{
+    // Arrange
+    std::istringstream str("\"a;b.FCStd\n");
+
+    // Act / Assert
+    EXPECT_THROW(App::BatchRunner::readJobs(str), Base::ParserError);
+}
+
+TEST_F(BatchRunnerTest, encodeJob)
+{
+    // Arrange
+    App::BatchJob job {"a;\"b\"\n.FCStd", {"c;d.step", "e.stl"}};
+
+    // Act
+    std::string line = App::BatchRunner::encodeJob(job);
+    App::BatchJob decoded = App::BatchRunner::decodeJob(line);
+
+    // Assert
+    EXPECT_EQ(line.find('\n'), std::string::npos);
+    EXPECT_EQ(decoded.input, job.input);
+    EXPECT_EQ(decoded.outputs, job.outputs);
+    EXPECT_THROW(App::BatchRunner::decodeJob("a.FCStd"), Base::ParserError);
+}
+
+TEST_F(BatchRunnerTest, encodeResult)
+{
+    // Arrange
+    App::BatchJobResult result;
+    result.error = "line\nbreak";
+    result.seconds = 1.5;
+    result.maxResidentKB = 1024;
+    App::BatchJobResult decoded;
+    decoded.success = true;
+
+    // Act
+    std::string line = App::BatchRunner::encodeResult(result);
+
+    // Assert
+    EXPECT_EQ(line.find('\n'), std::string::npos);
+    EXPECT_FALSE(App::BatchRunner::decodeResult("some output of the job", decoded));
+    // Output without a line break before the result is skipped
+    ASSERT_TRUE(App::BatchRunner::decodeResult("output" + line, decoded));
+    EXPECT_FALSE(decoded.success);
+    EXPECT_EQ(decoded.error, result.error);
+    EXPECT_DOUBLE_EQ(decoded.seconds, result.seconds);
+    EXPECT_EQ(decoded.maxResidentKB, result.maxResidentKB);
+}
+
+TEST_F(BatchRunnerTest, missingDocumentFails)
+{
+    // Arrange
+    App::BatchRunner::Options options;
+    options.jobs = 1;
+    App::BatchRunner runner(options);
+    std::vector<App::BatchJob> jobs {{"/nonexistent/document.FCStd", {}}};
+
+    // Act
+    auto results = runner.run(jobs);
+
+    // Assert
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_FALSE(results[0].success);
+    EXPECT_FALSE(results[0].error.empty());
+}
+
+TEST_F(BatchRunnerTest, serve)
+{
+    // Arrange
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+    doc->addObject("App::FeatureTest", "Feature");
+    Base::FileInfo file(Base::FileInfo::getTempFileName() + ".FCStd");
+    doc->saveAs(file.filePath().c_str());
+    App::GetApplication().closeDocument(docName.c_str());
+
+    App::BatchRunner runner(App::BatchRunner::Options {});
+    std::stringstream in;
+    in << App::BatchRunner::encodeJob({file.filePath(), {}}) << '\n'
+       << "\n"
+       << "invalid\n"
+       << App::BatchRunner::encodeJob({"/nonexistent/document.FCStd", {}}) << '\n'
+       << App::BatchRunner::encodeJob({file.filePath(), {}}) << '\n';
+    std::stringstream out;
+
+    // Act
+    runner.serve(in, out);
+    file.deleteFile();
+
+    // Assert
+    // One result line per job, in the order of the jobs
+    std::vector<App::BatchJobResult> results;
+    std::string line;
+    while (std::getline(out, line)) {
+        App::BatchJobResult result;
+        if (App::BatchRunner::decodeResult(line, result)) {
+            results.push_back(result);
+        }
+    }
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_TRUE(results[0].success) << results[0].error;
+    EXPECT_FALSE(results[1].success);
+    EXPECT_NE(results[1].error.find("Invalid batch job"), std::string::npos);
+    EXPECT_FALSE(results[2].success);
+    EXPECT_FALSE(results[2].error.empty());
+    EXPECT_TRUE(results[3].success) << results[3].error;
+}
+
+TEST_F(BatchRunnerTest, missingExecutableFails)
+{
+    // Arrange
+    App::BatchRunner::Options options;
+    options.jobs = 2;
+    options.executable = "/nonexistent/FreeCADCmd";
+    App::BatchRunner runner(options);
+    std::vector<App::BatchJob> jobs {{"a.FCStd", {}}, {"b.FCStd", {}}};
+
+    // Act
+    auto results = runner.run(jobs);
+
+    // Assert
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_FALSE(results[0].success);
+    EXPECT_FALSE(results[1].success);
+    EXPECT_NE(results[0].error.find("Cannot start"), std::string::npos);
+}
+
+TEST_F(BatchRunnerTest, writeReport)
+{
+    // Arrange
+    App::BatchRunner::Options options;
+    options.jobs = 2;
+    App::BatchRunner runner(options);
+    std::vector<App::BatchJob> jobs {{"a.FCStd", {"a.step"}}, {"b \"quoted\".FCStd", {}}};
+    std::vector<App::BatchJobResult> results(2);
+    results[0].success = true;
+    results[1].error = "line\nbreak";
+    std::ostringstream str;
+
+    // Act
+    runner.writeReport(str, jobs, results);
+    QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(str.str()));
+
+    // Assert
+    ASSERT_TRUE(doc.isObject());
+    QJsonObject report = doc.object();
+    EXPECT_EQ(report.value(QLatin1String("jobs")).toInt(), 2);
+    EXPECT_EQ(report.value(QLatin1String("workers")).toInt(), 2);
+    EXPECT_EQ(report.value(QLatin1String("succeeded")).toInt(), 1);
+    EXPECT_EQ(report.value(QLatin1String("failed")).toInt(), 1);
+    QJsonArray entries = report.value(QLatin1String("results")).toArray();
+    ASSERT_EQ(entries.size(), 2);
+    QJsonObject first = entries[0].toObject();
+    EXPECT_EQ(first.value(QLatin1String("input")).toString(), QLatin1String("a.FCStd"));
+    EXPECT_EQ(first.value(QLatin1String("outputs")).toArray(), QJsonArray {QLatin1String("a.step")});
+    EXPECT_TRUE(first.value(QLatin1String("success")).toBool());
+    QJsonObject second = entries[1].toObject();
+    EXPECT_EQ(second.value(QLatin1String("input")).toString(), QLatin1String("b \"quoted\".FCStd"));
+    EXPECT_FALSE(second.value(QLatin1String("success")).toBool());
+    EXPECT_EQ(second.value(QLatin1String("error")).toString(), QLatin1String("line\nbreak"));
+}
+
+// NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
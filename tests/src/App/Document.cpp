@@ -1,10 +1,14 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <sstream>
 #include <gmock/gmock.h>
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +98,260 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, getRecomputeProfileListsRecomputedObjects)
+{
+    // Arrange
+    auto* first = doc()->addObject("App::FeatureTest", "First");
+    auto* second = doc()->addObject("App::FeatureTest", "Second");
+
+    // Act
+    doc()->recompute({first, second}, true);
+    auto profile = doc()->getRecomputeProfile();
+
+    // Assert
+    ASSERT_THAT(profile.size(), Eq(2));
+    for (const auto& entry : profile) {
+        EXPECT_TRUE(entry.name == first->getNameInDocument()
+                    || entry.name == second->getNameInDocument());
+        EXPECT_GE(entry.total, 0.0);
+        EXPECT_DOUBLE_EQ(entry.self, entry.total);
+        EXPECT_THAT(entry.depth, Eq(0));
+    }
+}
+
+TEST_F(DocumentTest, getRecomputeProfileIsResetByNextRecompute)
+{
+    // Arrange
+    auto* first = doc()->addObject("App::FeatureTest", "First");
+    auto* second = doc()->addObject("App::FeatureTest", "Second");
+    doc()->recompute({first, second}, true);
+
+    // Act
+    doc()->recomputeFeature(second);
+    auto profile = doc()->getRecomputeProfile();
+
+    // Assert
+    ASSERT_THAT(profile.size(), Eq(1));
+    EXPECT_EQ(profile.front().name, second->getNameInDocument());
+}
+
+TEST_F(DocumentTest, getRecomputeProfileKeepsObjectsOfNestedRecompute)
+{
+    // Arrange
+    auto* first = doc()->addObject("App::FeatureTest", "First");
+    auto* second = doc()->addObject("App::FeatureTest", "Second");
+    auto* third = doc()->addObject("App::FeatureTest", "Third");
+    fastsignals::scoped_connection recomputed =
+        doc()->signalRecomputedObject.connect([&](const App::DocumentObject& obj) {
+            if (&obj == first) {
+                doc()->recomputeFeature(third);
+            }
+        });
+
+    // Act
+    doc()->recompute();
+    auto profile = doc()->getRecomputeProfile();
+
+    // Assert
+    auto contains = [&](App::DocumentObject* obj) {
+        return std::ranges::any_of(profile, [&](const auto& entry) {
+            return entry.name == obj->getNameInDocument();
+        });
+    };
+    EXPECT_GE(profile.size(), 3);
+    EXPECT_TRUE(contains(first));
+    EXPECT_TRUE(contains(second));
+    EXPECT_TRUE(contains(third));
+}
+
+TEST_F(DocumentTest, getRecomputeProfileSplitsSelfAndTotalTime)
+{
+    // Arrange
+    auto* first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto* second = doc()->addObject("App::FeatureTest", "Second");
+    bool nested = false;
+    // first changes its ExecCount while it executes, recompute second from there
+    fastsignals::scoped_connection changed = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            if (&obj == first && &prop == &first->ExecCount && !nested) {
+                nested = true;
+                doc()->recomputeFeature(second);
+            }
+        });
+
+    // Act
+    doc()->recompute({first}, true);
+    auto profile = doc()->getRecomputeProfile();
+
+    // Assert
+    ASSERT_THAT(profile.size(), Eq(2));
+    const auto& outer = profile[0];
+    const auto& inner = profile[1];
+    EXPECT_EQ(outer.name, first->getNameInDocument());
+    EXPECT_EQ(inner.name, second->getNameInDocument());
+    EXPECT_THAT(outer.depth, Eq(0));
+    EXPECT_THAT(inner.depth, Eq(1));
+    EXPECT_GE(inner.start, outer.start);
+    EXPECT_LE(inner.total, outer.total);
+    EXPECT_DOUBLE_EQ(inner.self, inner.total);
+    EXPECT_NEAR(outer.self, outer.total - inner.total, 1e-9);
+}
+
+TEST_F(DocumentTest, exportRecomputeProfileWritesTraceEvents)
+{
+    // Arrange
+    auto* first = doc()->addObject("App::FeatureTest", "First");
+    auto* second = doc()->addObject("App::FeatureTest", "Second");
+    doc()->recompute({first, second}, true);
+
+    // Act
+    std::stringstream str;
+    doc()->exportRecomputeProfile(str);
+    std::string trace = str.str();
+
+    // Assert
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\": \"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\": \"First\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\": \"Second\""), std::string::npos);
+}
+
+TEST_F(DocumentTest, addObjectsCreatesObjectsInOrder)
+{
+    // Arrange
+    std::vector<std::string> types {"App::FeatureTest",
+                                    "App::DocumentObjectGroup",
+                                    "App::FeatureTest"};
+    std::vector<std::string> names {"Box", "", "Box"};
+
+    // Act
+    auto objects = doc()->addObjects(types, names);
+
+    // Assert
+    ASSERT_THAT(objects.size(), Eq(3));
+    EXPECT_EQ(doc()->getObjects(), objects);
+    EXPECT_STREQ(objects[0]->getNameInDocument(), "Box");
+    EXPECT_STREQ(objects[1]->getTypeId().getName(), "App::DocumentObjectGroup");
+    EXPECT_STRNE(objects[2]->getNameInDocument(), "Box");
+    EXPECT_EQ(doc()->getActiveObject(), objects[2]);
+}
+
+TEST_F(DocumentTest, addObjectsRejectsBadTypeBeforeAddingObjects)
+{
+    // Arrange
+    std::vector<std::string> types {"App::FeatureTest", "Base::Persistence"};
+
+    // Act / Assert
+    EXPECT_THROW(doc()->addObjects(types, {}), Base::TypeError);
+    EXPECT_TRUE(doc()->getObjects().empty());
+    EXPECT_THROW(doc()->addObjects(types, {"First"}), Base::ValueError);
+}
+
+TEST_F(DocumentTest, bulkObjectCreationCoalescesNewObjectSignals)
+{
+    // Arrange
+    int newObjectCount = 0;
+    std::vector<std::vector<App::DocumentObject*>> batches;
+    auto newObject = doc()->signalNewObject.connect([&](const App::DocumentObject&) {
+        ++newObjectCount;
+    });
+    auto newObjects = doc()->signalNewObjects.connect(
+        [&](const std::vector<App::DocumentObject*>& objs) { batches.push_back(objs); });
+    std::vector<App::DocumentObject*> kept;
+
+    // Act
+    {
+        App::BulkObjectCreation bulk(doc());
+        kept.push_back(doc()->addObject("App::FeatureTest", "First"));
+        auto removed = doc()->addObject("App::FeatureTest", "Removed");
+        {
+            App::BulkObjectCreation nested(doc());
+            kept.push_back(doc()->addObject("App::FeatureTest", "Second"));
+        }
+        doc()->removeObject(removed->getNameInDocument());
+        EXPECT_TRUE(doc()->isBulkCreation());
+        EXPECT_THAT(newObjectCount, Eq(0));
+    }
+
+    // Assert
+    EXPECT_FALSE(doc()->isBulkCreation());
+    ASSERT_THAT(batches.size(), Eq(1));
+    EXPECT_EQ(batches.front(), kept);
+    EXPECT_THAT(newObjectCount, Eq(2));
+    newObject.disconnect();
+    newObjects.disconnect();
+}
+
+TEST_F(DocumentTest, bulkObjectCreationSignalOrder)
+{
+    // Arrange
+    std::vector<std::string> events;
+    auto record = [&](const char* event, const App::DocumentObject& obj) {
+        events.push_back(std::string(event) + " " + obj.getNameInDocument());
+    };
+    std::vector<fastsignals::scoped_connection> connections;
+    connections.emplace_back(doc()->signalTransactionAppend.connect(
+        [&](const App::DocumentObject& obj, App::Transaction*) { record("append", obj); }));
+    connections.emplace_back(doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            if (std::strcmp(prop.getName(), "Integer") == 0) {
+                record("changed", obj);
+            }
+        }));
+    connections.emplace_back(doc()->signalNewObjects.connect(
+        [&](const std::vector<App::DocumentObject*>&) { events.emplace_back("newObjects"); }));
+    connections.emplace_back(doc()->signalNewObject.connect(
+        [&](const App::DocumentObject& obj) { record("new", obj); }));
+    connections.emplace_back(doc()->signalActivatedObject.connect(
+        [&](const App::DocumentObject& obj) { record("activated", obj); }));
+    doc()->setUndoMode(1);
+    doc()->openTransaction("Bulk");
+
+    // Act
+    {
+        App::BulkObjectCreation bulk(doc());
+        auto obj = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+        obj->Integer.setValue(42);
+    }
+    doc()->commitTransaction();
+
+    // Assert
+    std::vector<std::string> expected {"append First",
+                                       "changed First",
+                                       "newObjects",
+                                       "new First",
+                                       "activated First"};
+    EXPECT_EQ(events, expected);
+}
+
+TEST_F(DocumentTest, bulkObjectCreationUndoesObjectRemovedInScope)
+{
+    // Arrange
+    std::vector<std::string> newObjects;
+    auto connection = doc()->signalNewObject.connect([&](const App::DocumentObject& obj) {
+        newObjects.emplace_back(obj.getNameInDocument());
+    });
+    doc()->setUndoMode(1);
+
+    // Act
+    doc()->openTransaction("Bulk");
+    {
+        App::BulkObjectCreation bulk(doc());
+        doc()->addObject("App::FeatureTest", "Kept");
+        doc()->addObject("App::FeatureTest", "Removed");
+        doc()->removeObject("Removed");
+    }
+    doc()->commitTransaction();
+    bool undone = doc()->undo();
+
+    // Assert
+    EXPECT_EQ(newObjects, std::vector<std::string> {"Kept"});
+    EXPECT_TRUE(undone);
+    EXPECT_TRUE(doc()->getObjects().empty());
+    EXPECT_TRUE(doc()->redo());
+    ASSERT_THAT(doc()->getObjects().size(), Eq(1));
+    EXPECT_STREQ(doc()->getObjects().front()->getNameInDocument(), "Kept");
+    connection.disconnect();
+}
+
 // NOLINTEND(readability-magic-numbers)
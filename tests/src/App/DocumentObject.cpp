@@ -9,6 +9,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/GeoFeatureGroupExtension.h>
+#include <App/Part.h>
 #include <Base/Interpreter.h>
 
 using namespace App;
@@ -155,4 +156,138 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, getSubObjectCachedMatchesGetSubObject)
+{
+    // Arrange
+    auto part = _doc->addObject<App::Part>("Part");
+    auto feature = _doc->addObject("App::FeatureTest", "Feature");
+    part->addObject(feature);
+    part->Placement.setValue(Base::Placement(Base::Vector3d(1, 2, 3), Base::Rotation()));
+    Base::Matrix4D expectedMat;
+    auto expected = part->getSubObject("Feature.", nullptr, &expectedMat);
+
+    // Act
+    Base::Matrix4D mat;
+    auto obj = part->getSubObjectCached("Feature.", &mat);
+    Base::Matrix4D cachedMat;
+    auto cachedObj = part->getSubObjectCached("Feature.", &cachedMat);
+
+    // Assert
+    EXPECT_EQ(obj, feature);
+    EXPECT_EQ(obj, expected);
+    EXPECT_EQ(cachedObj, feature);
+    EXPECT_EQ(mat, expectedMat);
+    EXPECT_EQ(cachedMat, expectedMat);
+}
+
+TEST_F(DocumentObjectTest, getSubObjectCachedFollowsPropertyChanges)
+{
+    // Arrange
+    auto part = _doc->addObject<App::Part>("Part");
+    auto feature = _doc->addObject("App::FeatureTest", "Feature");
+    part->addObject(feature);
+    Base::Matrix4D mat;
+    part->getSubObjectCached("Feature.", &mat);
+
+    // Act
+    part->Placement.setValue(Base::Placement(Base::Vector3d(1, 2, 3), Base::Rotation()));
+    Base::Matrix4D movedMat;
+    part->getSubObjectCached("Feature.", &movedMat);
+    part->removeObject(feature);
+    auto removed = part->getSubObjectCached("Feature.");
+
+    // Assert
+    EXPECT_EQ(mat, Base::Matrix4D());
+    EXPECT_EQ(movedMat.getCol(3), Base::Vector3d(1, 2, 3));
+    EXPECT_EQ(removed, nullptr);
+}
+
+TEST_F(DocumentObjectTest, getSubObjectsCachedResolvesList)
+{
+    // Arrange
+    auto part = _doc->addObject<App::Part>("Part");
+    auto feature = _doc->addObject("App::FeatureTest", "Feature");
+    part->addObject(feature);
+    std::vector<Base::Matrix4D> mats;
+
+    // Act
+    auto objs = part->getSubObjectsCached({"Feature.", "Missing.", ""}, &mats);
+
+    // Assert
+    EXPECT_EQ(objs, (std::vector<DocumentObject*> {feature, nullptr, part}));
+    EXPECT_EQ(mats.size(), 3);
+}
+
+TEST_F(DocumentObjectTest, getSubObjectCachedReturnsElementName)
+{
+    // Arrange
+    auto part = _doc->addObject<App::Part>("Part");
+    auto feature = _doc->addObject("App::FeatureTest", "Feature");
+    part->addObject(feature);
+    std::string subname("Feature.Face1");
+    std::vector<std::string> subnames {"Feature.Edge2", "Feature."};
+    std::vector<const char*> elements;
+
+    // Act
+    const char* element = nullptr;
+    auto obj = part->getSubObjectCached(subname.c_str(), nullptr, true, &element);
+    const char* cachedElement = nullptr;
+    auto cachedObj = part->getSubObjectCached(subname.c_str(), nullptr, true, &cachedElement);
+    auto objs = part->getSubObjectsCached(subnames, nullptr, true, &elements);
+
+    // Assert
+    EXPECT_EQ(obj, feature);
+    EXPECT_EQ(cachedObj, feature);
+    EXPECT_STREQ(element, "Face1");
+    EXPECT_EQ(cachedElement, subname.c_str() + strlen("Feature."));
+    EXPECT_EQ(objs, (std::vector<DocumentObject*> {feature, feature}));
+    ASSERT_EQ(elements.size(), 2);
+    EXPECT_STREQ(elements[0], "Edge2");
+    EXPECT_STREQ(elements[1], "");
+}
+
+TEST_F(DocumentObjectTest, getSubObjectCachedFollowsNestedPlacement)
+{
+    // Arrange
+    auto outer = _doc->addObject<App::Part>("Outer");
+    auto inner = _doc->addObject<App::Part>("Inner");
+    auto feature = _doc->addObject("App::FeatureTest", "Feature");
+    outer->addObject(inner);
+    inner->addObject(feature);
+    Base::Matrix4D mat;
+    auto obj = outer->getSubObjectCached("Inner.Feature.", &mat);
+
+    // Act
+    // Only the placement of an object in the middle of the path changes
+    inner->Placement.setValue(Base::Placement(Base::Vector3d(4, 5, 6), Base::Rotation()));
+    Base::Matrix4D movedMat;
+    auto movedObj = outer->getSubObjectCached("Inner.Feature.", &movedMat);
+    Base::Matrix4D expectedMat;
+    outer->getSubObject("Inner.Feature.", nullptr, &expectedMat);
+
+    // Assert
+    EXPECT_EQ(obj, feature);
+    EXPECT_EQ(movedObj, feature);
+    EXPECT_EQ(mat, Base::Matrix4D());
+    EXPECT_EQ(movedMat, expectedMat);
+    EXPECT_EQ(movedMat.getCol(3), Base::Vector3d(4, 5, 6));
+}
+
+TEST_F(DocumentObjectTest, getSubObjectCachedAfterObjectRemoved)
+{
+    // Arrange
+    auto part = _doc->addObject<App::Part>("Part");
+    auto feature = _doc->addObject("App::FeatureTest", "Feature");
+    part->addObject(feature);
+    auto obj = part->getSubObjectCached("Feature.");
+
+    // Act
+    _doc->removeObject("Feature");
+    auto removed = part->getSubObjectCached("Feature.");
+
+    // Assert
+    EXPECT_EQ(obj, feature);
+    EXPECT_EQ(removed, nullptr);
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <Base/Type.h>
+
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+class TypeTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        root = Base::Type::createType(Base::Type::BadType, "TypeTest::Root");
+        child = Base::Type::createType(root, "TypeTest::Child");
+        grandChild = Base::Type::createType(child, "TypeTest::GrandChild");
+        sibling = Base::Type::createType(root, "TypeTest::Sibling");
+        other = Base::Type::createType(Base::Type::BadType, "TypeTest::Other");
+    }
+
+    static Base::Type root;
+    static Base::Type child;
+    static Base::Type grandChild;
+    static Base::Type sibling;
+    static Base::Type other;
+};
+
+Base::Type TypeTest::root;
+Base::Type TypeTest::child;
+Base::Type TypeTest::grandChild;
+Base::Type TypeTest::sibling;
+Base::Type TypeTest::other;
+
+TEST_F(TypeTest, isDerivedFromItself)
+{
+    EXPECT_TRUE(root.isDerivedFrom(root));
+    EXPECT_TRUE(grandChild.isDerivedFrom(grandChild));
+}
+
+TEST_F(TypeTest, isDerivedFromAncestors)
+{
+    EXPECT_TRUE(child.isDerivedFrom(root));
+    EXPECT_TRUE(grandChild.isDerivedFrom(child));
+    EXPECT_TRUE(grandChild.isDerivedFrom(root));
+    EXPECT_TRUE(sibling.isDerivedFrom(root));
+}
+
+TEST_F(TypeTest, isNotDerivedFromDescendantsOrUnrelated)
+{
+    EXPECT_FALSE(root.isDerivedFrom(child));
+    EXPECT_FALSE(child.isDerivedFrom(grandChild));
+    EXPECT_FALSE(grandChild.isDerivedFrom(sibling));
+    EXPECT_FALSE(sibling.isDerivedFrom(child));
+    EXPECT_FALSE(grandChild.isDerivedFrom(other));
+    EXPECT_FALSE(other.isDerivedFrom(root));
+}
+
+TEST_F(TypeTest, isDerivedFromBadType)
+{
+    EXPECT_FALSE(root.isDerivedFrom(Base::Type::BadType));
+    EXPECT_FALSE(Base::Type::BadType.isDerivedFrom(root));
+    EXPECT_TRUE(Base::Type::BadType.isDerivedFrom(Base::Type::BadType));
+}
+
+TEST_F(TypeTest, getAllDerivedFrom)
+{
+    std::vector<Base::Type> types;
+    EXPECT_EQ(Base::Type::getAllDerivedFrom(child, types), 2);
+    EXPECT_EQ(types, (std::vector<Base::Type> {child, grandChild}));
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/Interpreter.h>
+#include <Mod/Import/App/ImportOCAF2.h>
+#include <Mod/Part/App/PartFeature.h>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Trsf.hxx>
+#include <Quantity_Color.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <XCAFApp_Application.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_GraphNode.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace
+{
+
+// Records the element colors that the importer hands over to the view provider
+class ImportRecorder: public Import::ImportOCAFExt
+{
+public:
+    using Import::ImportOCAFExt::ImportOCAFExt;
+
+    std::vector<std::map<std::string, Base::Color>> elementColors;
+
+private:
+    void applyElementColors(App::DocumentObject* /*obj*/,
+                            const std::map<std::string, Base::Color>& colors) override
+    {
+        if (!colors.empty()) {
+            elementColors.push_back(colors);
+        }
+    }
+};
+
+}  // namespace
+
+class ImportOCAF2Test: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        Base::Interpreter().runString("import Part");
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* getDocument() const
+    {
+        return _doc;
+    }
+
+    static Handle(TDocStd_Document) newDocument()
+    {
+        Handle(XCAFApp_Application) hApp = XCAFApp_Application::GetApplication();
+        Handle(TDocStd_Document) hDoc;
+        hApp->NewDocument(TCollection_ExtendedString("MDTV-CAF"), hDoc);
+        return hDoc;
+    }
+
+    static TopLoc_Location translation(double x)
+    {
+        gp_Trsf trsf;
+        trsf.SetTranslation(gp_Vec(x, 0.0, 0.0));
+        return TopLoc_Location(trsf);
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc = nullptr;
+};
+
+TEST_F(ImportOCAF2Test, sharedPartWithFaceAndInstanceColors)
+{
+    // Arrange
+    // Top assembly -> one sub-assembly -> two instances of the same box, the first
+    // box face has its own color and the first instance has an instance (SHUO) color
+    Handle(TDocStd_Document) hDoc = newDocument();
+    Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    Handle(XCAFDoc_ColorTool) colorTool = XCAFDoc_DocumentTool::ColorTool(hDoc->Main());
+
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    TopExp_Explorer xp(box, TopAbs_FACE);
+    TopoDS_Shape face = xp.Current();
+
+    TDF_Label part = shapeTool->AddShape(box, Standard_False);
+    TDF_Label faceLabel = shapeTool->AddSubShape(part, face);
+    ASSERT_FALSE(faceLabel.IsNull());
+    colorTool->SetColor(faceLabel, Quantity_Color(1.0, 0.0, 0.0, Quantity_TOC_RGB), XCAFDoc_ColorSurf);
+
+    TDF_Label subAssembly = shapeTool->NewShape();
+    TDF_Label first = shapeTool->AddComponent(subAssembly, part, translation(0.0));
+    shapeTool->AddComponent(subAssembly, part, translation(20.0));
+    TDF_Label top = shapeTool->NewShape();
+    TDF_Label instance = shapeTool->AddComponent(top, subAssembly, TopLoc_Location());
+    shapeTool->UpdateAssemblies();
+
+    TDF_LabelSequence shuoPath;
+    shuoPath.Append(instance);
+    shuoPath.Append(first);
+    Handle(XCAFDoc_GraphNode) shuo;
+    ASSERT_TRUE(shapeTool->SetSHUO(shuoPath, shuo));
+    colorTool->SetColor(shuo->Label(), Quantity_Color(0.0, 1.0, 0.0, Quantity_TOC_RGB), XCAFDoc_ColorSurf);
+
+    ImportRecorder ocaf(hDoc, getDocument(), "test");
+    ocaf.setMerge(false);
+    ocaf.setUseLinkGroup(true);
+    ocaf.setReduceObjects(false);
+    ocaf.setExpandCompound(false);
+
+    // Act
+    ocaf.loadShapes();
+
+    // Assert
+    // the two instances share a single part feature
+    auto features = getDocument()->getObjectsOfType(Part::Feature::getClassTypeId());
+    std::vector<Part::Feature*> parts;
+    for (auto obj : features) {
+        auto feature = static_cast<Part::Feature*>(obj);
+        if (ocaf.partColors.count(feature)) {
+            parts.push_back(feature);
+        }
+    }
+    ASSERT_EQ(parts.size(), 1U);
+
+    // the face color lands at the index of the colored face
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(box, TopAbs_FACE, faces);
+    int faceIndex = faces.FindIndex(face) - 1;
+    const auto& colors = ocaf.partColors[parts.front()];
+    ASSERT_EQ(colors.size(), 6U);
+    EXPECT_EQ(colors[faceIndex], Base::Color(1.0F, 0.0F, 0.0F));
+
+    // the instance color is keyed by the link names along the instance path
+    ASSERT_EQ(ocaf.elementColors.size(), 1U);
+    ASSERT_EQ(ocaf.elementColors.front().size(), 1U);
+    const auto& [subname, color] = *ocaf.elementColors.front().begin();
+    EXPECT_EQ(color, Base::Color(0.0F, 1.0F, 0.0F));
+    auto dot = subname.find('.');
+    ASSERT_NE(dot, std::string::npos);
+    EXPECT_NE(getDocument()->getObject(subname.substr(0, dot).c_str()), nullptr);
+    std::string rest = subname.substr(dot + 1);
+    ASSERT_FALSE(rest.empty());
+    EXPECT_EQ(rest.back(), '.');
+    EXPECT_NE(getDocument()->getObject(rest.substr(0, rest.size() - 1).c_str()), nullptr);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
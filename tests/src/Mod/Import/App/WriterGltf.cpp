@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
+#include <Mod/Import/App/ExportOCAF2.h>
+#include <Mod/Import/App/ReaderGltf.h>
+#include <Mod/Import/App/WriterGltf.h>
+#include <Mod/Part/App/FeaturePartBox.h>
+
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Bnd_Box.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <XCAFApp_Application.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class WriterGltfTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        Base::Interpreter().runString("import Part");
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _file.setFile(Base::FileInfo::getTempFileName() + ".glb");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+        _file.deleteFile();
+    }
+
+    App::Document* getDocument() const
+    {
+        return _doc;
+    }
+
+    const Base::FileInfo& getFile() const
+    {
+        return _file;
+    }
+
+    static Handle(TDocStd_Document) newDocument()
+    {
+        Handle(XCAFApp_Application) hApp = XCAFApp_Application::GetApplication();
+        Handle(TDocStd_Document) hDoc;
+        hApp->NewDocument(TCollection_ExtendedString("MDTV-CAF"), hDoc);
+        return hDoc;
+    }
+
+    static bool hasTriangulation(const TopoDS_Shape& shape)
+    {
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            TopLoc_Location loc;
+            if (!BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {nullptr};
+    Base::FileInfo _file;
+};
+
+TEST_F(WriterGltfTest, exportRoundTrip)
+{
+    // Arrange
+    auto box = getDocument()->addObject<Part::Box>("Box");
+    box->Length.setValue(10.0);
+    box->Width.setValue(20.0);
+    box->Height.setValue(30.0);
+    getDocument()->recompute();
+    ASSERT_FALSE(hasTriangulation(box->Shape.getValue()));
+
+    Handle(TDocStd_Document) hDoc = newDocument();
+    std::vector<App::DocumentObject*> objs {box};
+    Import::ExportOCAF2 ocaf(hDoc);
+    ocaf.setExportOptions(Import::ExportOCAF2::customExportOptions());
+    ocaf.exportObjects(objs);
+
+    // Act
+    Import::WriterGltf writer(getFile());
+    writer.write(hDoc);
+
+    // Assert
+    // The tessellation for the export is not left on the document's shape
+    EXPECT_FALSE(hasTriangulation(box->Shape.getValue()));
+    ASSERT_TRUE(getFile().exists());
+    EXPECT_GT(getFile().size(), 0);
+
+    Handle(TDocStd_Document) hDocRead = newDocument();
+    Import::ReaderGltf reader(getFile());
+    reader.read(hDocRead);
+
+    Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(hDocRead->Main());
+    TDF_LabelSequence labels;
+    shapeTool->GetFreeShapes(labels);
+    ASSERT_EQ(labels.Length(), 1);
+    TopoDS_Shape shape = XCAFDoc_ShapeTool::GetShape(labels.Value(1));
+    ASSERT_FALSE(shape.IsNull());
+
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    Standard_Real xMin {}, yMin {}, zMin {}, xMax {}, yMax {}, zMax {};
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    const double tol = 1e-2;
+    EXPECT_NEAR(xMax - xMin, 10.0, tol);
+    EXPECT_NEAR(yMax - yMin, 20.0, tol);
+    EXPECT_NEAR(zMax - zMin, 30.0, tol);
+
+    XCAFApp_Application::GetApplication()->Close(hDocRead);
+    XCAFApp_Application::GetApplication()->Close(hDoc);
+}
+
+TEST_F(WriterGltfTest, exportKeepsExistingTriangulation)
+{
+    // Arrange
+    auto box = getDocument()->addObject<Part::Box>("Box");
+    getDocument()->recompute();
+    BRepMesh_IncrementalMesh(box->Shape.getValue(), 0.1);
+    ASSERT_TRUE(hasTriangulation(box->Shape.getValue()));
+
+    Handle(TDocStd_Document) hDoc = newDocument();
+    std::vector<App::DocumentObject*> objs {box};
+    Import::ExportOCAF2 ocaf(hDoc);
+    ocaf.setExportOptions(Import::ExportOCAF2::customExportOptions());
+    ocaf.exportObjects(objs);
+
+    // Act
+    Import::WriterGltf writer(getFile());
+    writer.write(hDoc);
+
+    // Assert
+    // A triangulation that was there before the export is not removed
+    EXPECT_TRUE(hasTriangulation(box->Shape.getValue()));
+    EXPECT_GT(getFile().size(), 0);
+
+    XCAFApp_Application::GetApplication()->Close(hDoc);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
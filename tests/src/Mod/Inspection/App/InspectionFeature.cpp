@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <Base/Converter.h>
+#include <Base/Interpreter.h>
+#include <App/Document.h>
+#include <src/App/InitApplication.h>
+#include <Mod/Inspection/App/InspectionFeature.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/MeshFeature.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <Mod/Points/App/PointsFeature.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class InspectionFeatureTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        Base::Interpreter().runString("import Inspection");
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+
+        // A lattice of points in random order, so that the index order
+        // differs from the spatial order of the inspection
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                for (int k = 0; k < 20; k++) {
+                    points.emplace_back(0.5F * i, 0.5F * j, 0.5F * k);
+                }
+            }
+        }
+        std::shuffle(points.begin(), points.end(), std::mt19937(42));
+        Points::PointKernel kernel;
+        kernel.setBasicPoints(points);
+
+        _actual = _doc->addObject<Points::Feature>("Actual");
+        _actual->Points.setValue(kernel);
+        _inspection = _doc->addObject<Inspection::Feature>("Inspection");
+        _inspection->Actual.setValue(_actual);
+        _inspection->SearchRadius.setValue(radius);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    // A plane at z = 5 that covers the lattice
+    Mesh::Feature* addPlane()
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        facets.emplace_back(
+            Base::Vector3f(-1, -1, 5),
+            Base::Vector3f(11, -1, 5),
+            Base::Vector3f(11, 11, 5)
+        );
+        facets.emplace_back(
+            Base::Vector3f(-1, -1, 5),
+            Base::Vector3f(11, 11, 5),
+            Base::Vector3f(-1, 11, 5)
+        );
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+
+        auto plane = _doc->addObject<Mesh::Feature>("Plane");
+        plane->Mesh.setValue(kernel);
+        return plane;
+    }
+
+    Part::Feature* addBox()
+    {
+        auto box = _doc->addObject<Part::Feature>("Box");
+        box->Shape.setValue(BRepPrimAPI_MakeBox(gp_Pnt(2, 2, 2), 5, 5, 5).Shape());
+        return box;
+    }
+
+    // The distances computed point by point in index order
+    std::vector<float> expectedDistances(const Inspection::InspectNominalGeometry& nominal) const
+    {
+        const Points::PointKernel& kernel = _actual->Points.getValue();
+        std::vector<float> distances;
+        for (const auto& it : kernel) {
+            float dist = nominal.getDistance(Base::convertTo<Base::Vector3f>(it));
+            if (dist > radius) {
+                dist = std::numeric_limits<float>::max();
+            }
+            else if (-dist > radius) {
+                dist = -std::numeric_limits<float>::max();
+            }
+            distances.push_back(dist);
+        }
+        return distances;
+    }
+
+    void checkStatistics(const std::vector<float>& distances) const
+    {
+        double sumsq = 0.0;
+        int count = 0;
+        float minDist = std::numeric_limits<float>::max();
+        float maxDist = -std::numeric_limits<float>::max();
+        for (float dist : distances) {
+            if (std::fabs(dist) < std::numeric_limits<float>::max()) {
+                sumsq += double(dist) * double(dist);
+                count++;
+                minDist = std::min(minDist, dist);
+                maxDist = std::max(maxDist, dist);
+            }
+        }
+        ASSERT_GT(count, 0);
+
+        EXPECT_NEAR(_inspection->RMS.getValue(), std::sqrt(sumsq / count), 1e-5);
+        EXPECT_FLOAT_EQ(_inspection->MinDistance.getValue(), minDist);
+        EXPECT_FLOAT_EQ(_inspection->MaxDistance.getValue(), maxDist);
+
+        const std::vector<long>& histogram = _inspection->Histogram.getValues();
+        EXPECT_EQ(histogram.size(), std::size_t(_inspection->HistogramBins.getValue()));
+        EXPECT_EQ(std::accumulate(histogram.begin(), histogram.end(), 0L), count);
+    }
+
+    static constexpr float radius = 1.2F;
+    std::string _docName;
+    App::Document* _doc {};
+    Points::Feature* _actual {};
+    Inspection::Feature* _inspection {};
+};
+
+TEST_F(InspectionFeatureTest, testMeshDistancesMatchIndexOrder)
+{
+    // Arrange
+    Mesh::Feature* plane = addPlane();
+    _inspection->Nominals.setValues({plane});
+    Inspection::InspectNominalMesh nominal(plane->Mesh.getValue(), radius);
+    std::vector<float> expected = expectedDistances(nominal);
+
+    // Act
+    _doc->recompute();
+
+    // Assert
+    const std::vector<float>& distances = _inspection->Distances.getValues();
+    ASSERT_EQ(distances.size(), expected.size());
+    for (std::size_t i = 0; i < distances.size(); i++) {
+        EXPECT_FLOAT_EQ(distances[i], expected[i]) << "point " << i;
+    }
+    checkStatistics(distances);
+}
+
+TEST_F(InspectionFeatureTest, testShapeDistancesMatchIndexOrder)
+{
+    // Arrange
+    Part::Feature* box = addBox();
+    _inspection->Nominals.setValues({box});
+    Inspection::InspectNominalShape nominal(box->Shape.getValue(), radius);
+    std::vector<float> expected = expectedDistances(nominal);
+
+    // Act
+    _doc->recompute();
+
+    // Assert
+    const std::vector<float>& distances = _inspection->Distances.getValues();
+    ASSERT_EQ(distances.size(), expected.size());
+    for (std::size_t i = 0; i < distances.size(); i++) {
+        EXPECT_NEAR(distances[i], expected[i], 1e-5F) << "point " << i;
+    }
+    checkStatistics(distances);
+}
+
+TEST_F(InspectionFeatureTest, testHistogramBins)
+{
+    // Arrange
+    Mesh::Feature* plane = addPlane();
+    _inspection->Nominals.setValues({plane});
+    _doc->recompute();
+    ASSERT_EQ(_inspection->Histogram.getSize(), 20);
+
+    // Act
+    _inspection->HistogramBins.setValue(4);
+    _doc->recompute();
+
+    // Assert
+    // 400 points each have the distances -1, -0.5, 0, 0.5 and 1 to the plane
+    const std::vector<long>& histogram = _inspection->Histogram.getValues();
+    ASSERT_EQ(histogram.size(), 4);
+    EXPECT_EQ(histogram[0], 400);
+    EXPECT_EQ(histogram[1], 400);
+    EXPECT_EQ(histogram[2], 800);
+    EXPECT_EQ(histogram[3], 400);
+    EXPECT_FLOAT_EQ(_inspection->MinDistance.getValue(), -1.0F);
+    EXPECT_FLOAT_EQ(_inspection->MaxDistance.getValue(), 1.0F);
+    checkStatistics(_inspection->Distances.getValues());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/ShapeValidator.h>
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <TopoDS_Wire.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class ShapeValidatorTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        Part::ShapeValidator::clearCache();
+    }
+
+    void TearDown() override
+    {
+        Part::ShapeValidator::setAutoCheck(false);
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    static TopoDS_Shape emptyWire()
+    {
+        TopoDS_Wire wire;
+        BRep_Builder().MakeWire(wire);
+        return wire;
+    }
+
+    App::Document* getDocument() const
+    {
+        return _doc;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {nullptr};
+};
+
+TEST_F(ShapeValidatorTest, validShape)
+{
+    // Arrange
+    auto box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+
+    // Act
+    auto result = Part::ShapeValidator::check(box, true);
+
+    // Assert
+    EXPECT_TRUE(result.valid);
+    EXPECT_TRUE(result.issues.empty());
+}
+
+TEST_F(ShapeValidatorTest, invalidShapeNamesElement)
+{
+    // Act
+    auto result = Part::ShapeValidator::check(emptyWire());
+
+    // Assert
+    EXPECT_FALSE(result.valid);
+    ASSERT_FALSE(result.issues.empty());
+    EXPECT_EQ(result.issues.front().element, "Wire1");
+    EXPECT_EQ(result.issues.front().check, "BRepCheck");
+}
+
+TEST_F(ShapeValidatorTest, nullShapeIsInvalid)
+{
+    // Act
+    auto result = Part::ShapeValidator::check(TopoDS_Shape());
+
+    // Assert
+    EXPECT_FALSE(result.valid);
+}
+
+TEST_F(ShapeValidatorTest, checkManyShapesKeepsOrder)
+{
+    // Arrange
+    std::vector<TopoDS_Shape> shapes;
+    for (int i = 0; i < 20; ++i) {
+        shapes.push_back(
+            i % 5 == 0 ? emptyWire() : BRepPrimAPI_MakeBox(1.0 + i, 1.0, 1.0).Shape()
+        );
+    }
+
+    // Act
+    auto results = Part::ShapeValidator::check(shapes);
+    auto cachedResults = Part::ShapeValidator::check(shapes);
+
+    // Assert
+    ASSERT_EQ(results.size(), shapes.size());
+    ASSERT_EQ(cachedResults.size(), shapes.size());
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        EXPECT_EQ(results[i].valid, i % 5 != 0);
+        EXPECT_EQ(cachedResults[i].valid, results[i].valid);
+        EXPECT_EQ(cachedResults[i].issues.size(), results[i].issues.size());
+    }
+}
+
+TEST_F(ShapeValidatorTest, cacheDropsUnusedShapes)
+{
+    // Arrange
+    TopoDS_Shape kept = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape();
+    {
+        TopoDS_Shape dropped = BRepPrimAPI_MakeBox(2.0, 1.0, 1.0).Shape();
+
+        // Act
+        Part::ShapeValidator::check({kept, dropped});
+        EXPECT_EQ(Part::ShapeValidator::cacheSize(), 2U);
+    }
+
+    // Assert
+    // the cache does not keep the second box alive
+    EXPECT_EQ(Part::ShapeValidator::cacheSize(), 1U);
+}
+
+TEST_F(ShapeValidatorTest, closingDocumentClearsCache)
+{
+    // Arrange
+    std::string name = App::GetApplication().getUniqueDocumentName("other");
+    App::GetApplication().newDocument(name.c_str(), "testUser");
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape();
+    Part::ShapeValidator::check(box);
+    EXPECT_EQ(Part::ShapeValidator::cacheSize(), 1U);
+
+    // Act
+    App::GetApplication().closeDocument(name.c_str());
+
+    // Assert
+    EXPECT_EQ(Part::ShapeValidator::cacheSize(), 0U);
+}
+
+TEST_F(ShapeValidatorTest, autoCheckFlagsInvalidFeatures)
+{
+    // Arrange
+    auto valid = getDocument()->addObject<Part::Feature>("Valid");
+    valid->Shape.setValue(BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape());
+    auto invalid = getDocument()->addObject<Part::Feature>("Invalid");
+    invalid->Shape.setValue(emptyWire());
+
+    // Act
+    EXPECT_FALSE(Part::ShapeValidator::setAutoCheck(true));
+    getDocument()->recompute();
+    auto flagged = Part::ShapeValidator::getInvalidObjects();
+    invalid->Shape.setValue(BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape());
+    getDocument()->recompute();
+    auto fixed = Part::ShapeValidator::getInvalidObjects();
+
+    // Assert
+    EXPECT_TRUE(Part::ShapeValidator::isAutoCheck());
+    EXPECT_EQ(flagged, std::vector<std::string> {invalid->getFullName()});
+    EXPECT_TRUE(fixed.empty());
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
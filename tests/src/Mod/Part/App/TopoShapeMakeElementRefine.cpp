@@ -4,6 +4,11 @@
 
 #include <src/App/InitApplication.h>
 
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <gp_Pln.hxx>
+
+#include <Mod/Part/App/modelRefine.h>
+
 #include "PartTestHelpers.h"
 
 class FeaturePartMakeElementRefineTest: public ::testing::Test,
@@ -54,3 +59,26 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, faceEqualitySplitterGroupsCoplanarFaces)
+{
+    // Arrange
+    ModelRefine::FaceVectorType faces;
+    for (int i = 0; i < 4; ++i) {
+        // two faces on each of the planes z = 0 and z = 5, and one on z = 5 + 1e-3
+        double z = i < 2 ? 0.0 : 5.0;
+        gp_Pln plane(gp_Pnt(i * 10.0, 0.0, z), gp_Dir(0.0, 0.0, i % 2 ? 1.0 : -1.0));
+        faces.push_back(BRepBuilderAPI_MakeFace(plane, 0.0, 1.0, 0.0, 1.0).Face());
+    }
+    gp_Pln offsetPlane(gp_Pnt(0.0, 0.0, 5.0 + 1e-3), gp_Dir(0.0, 0.0, 1.0));
+    faces.push_back(BRepBuilderAPI_MakeFace(offsetPlane, 0.0, 1.0, 0.0, 1.0).Face());
+    ModelRefine::FaceEqualitySplitter splitter;
+
+    // Act
+    splitter.split(faces, &ModelRefine::getPlaneObject());
+
+    // Assert
+    ASSERT_EQ(splitter.getGroupCount(), 2);
+    EXPECT_EQ(splitter.getGroup(0).size(), 2);
+    EXPECT_EQ(splitter.getGroup(1).size(), 2);
+}
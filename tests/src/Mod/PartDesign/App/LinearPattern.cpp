@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <numbers>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/Origin.h>
+#include <Mod/PartDesign/App/Body.h>
+#include <Mod/PartDesign/App/FeatureLinearPattern.h>
+#include <Mod/PartDesign/App/FeaturePrimitive.h>
+
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <TopExp_Explorer.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class LinearPatternTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _body = _doc->addObject<PartDesign::Body>();
+
+        // a 10 x 10 x 10 block as support
+        auto box = _doc->addObject<PartDesign::AdditiveBox>("Box");
+        _body->addObject(box);
+        box->Length.setValue(10.0);
+        box->Width.setValue(10.0);
+        box->Height.setValue(10.0);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* getDocument() const
+    {
+        return _doc;
+    }
+
+    PartDesign::Body* getBody() const
+    {
+        return _body;
+    }
+
+    template<typename T>
+    T* addCylinder(const Base::Vector3d& pos)
+    {
+        auto cylinder = _doc->addObject<T>("Cylinder");
+        _body->addObject(cylinder);
+        cylinder->Radius.setValue(1.0);
+        cylinder->Height.setValue(10.0);
+        cylinder->Placement.setValue(Base::Placement(pos, Base::Rotation()));
+        return cylinder;
+    }
+
+    PartDesign::LinearPattern* addPattern(App::DocumentObject* original, double length, int occurrences)
+    {
+        auto pattern = _doc->addObject<PartDesign::LinearPattern>("LinearPattern");
+        _body->addObject(pattern);
+        pattern->Originals.setValues({original});
+        pattern->Direction.setValue(_body->getOrigin()->getX(), {""});
+        pattern->Length.setValue(length);
+        pattern->Occurrences.setValue(occurrences);
+        return pattern;
+    }
+
+    static double volume(const TopoDS_Shape& shape)
+    {
+        GProp_GProps props;
+        BRepGProp::VolumeProperties(shape, props);
+        return props.Mass();
+    }
+
+    static int countSolids(const TopoDS_Shape& shape)
+    {
+        int count = 0;
+        for (TopExp_Explorer xp(shape, TopAbs_SOLID); xp.More(); xp.Next()) {
+            count++;
+        }
+        return count;
+    }
+
+    static constexpr double hole = std::numbers::pi * 10.0;
+
+private:
+    std::string _docName;
+    App::Document* _doc = nullptr;
+    PartDesign::Body* _body = nullptr;
+};
+
+TEST_F(LinearPatternTest, cutSkipsCopiesOffSupport)
+{
+    // Arrange
+    // copies at x = 2, 8, 14 and 20, of which the last two miss the block
+    auto cylinder = addCylinder<PartDesign::SubtractiveCylinder>(Base::Vector3d(2, 5, 0));
+    auto pattern = addPattern(cylinder, 18.0, 4);
+
+    // Act
+    getDocument()->recompute();
+
+    // Assert
+    EXPECT_TRUE(pattern->isValid());
+    const TopoDS_Shape& shape = pattern->Shape.getValue();
+    EXPECT_EQ(countSolids(shape), 1);
+    EXPECT_NEAR(volume(shape), 1000.0 - 2 * hole, 1e-6);
+    EXPECT_EQ(countSolids(pattern->rejected), 0);
+}
+
+TEST_F(LinearPatternTest, cutWithAllCopiesOffSupport)
+{
+    // Arrange
+    auto cylinder = addCylinder<PartDesign::SubtractiveCylinder>(Base::Vector3d(2, 5, 0));
+    auto pattern = addPattern(cylinder, 30.0, 3);
+
+    // Act
+    getDocument()->recompute();
+
+    // Assert
+    // only the original hole is left
+    EXPECT_TRUE(pattern->isValid());
+    const TopoDS_Shape& shape = pattern->Shape.getValue();
+    EXPECT_EQ(countSolids(shape), 1);
+    EXPECT_NEAR(volume(shape), 1000.0 - hole, 1e-6);
+    EXPECT_NEAR(volume(shape), volume(cylinder->Shape.getValue()), 1e-6);
+    EXPECT_EQ(countSolids(pattern->rejected), 0);
+}
+
+TEST_F(LinearPatternTest, fuseRejectsCopiesOffSupport)
+{
+    // Arrange
+    // copies at x = 5 and 25 on top of the block, the second one touches nothing
+    auto cylinder = addCylinder<PartDesign::AdditiveCylinder>(Base::Vector3d(5, 5, 10));
+    auto pattern = addPattern(cylinder, 20.0, 2);
+
+    // Act
+    getDocument()->recompute();
+
+    // Assert
+    const TopoDS_Shape& shape = pattern->Shape.getValue();
+    EXPECT_EQ(countSolids(shape), 1);
+    EXPECT_NEAR(volume(shape), 1000.0 + hole, 1e-6);
+    ASSERT_EQ(countSolids(pattern->rejected), 1);
+    EXPECT_NEAR(volume(pattern->rejected), hole, 1e-6);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
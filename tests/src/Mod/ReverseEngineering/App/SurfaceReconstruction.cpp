@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <Base/Converter.h>
+#include <Base/Exception.h>
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/ReverseEngineering/App/SurfaceReconstruction.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SurfaceReconstructionTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Evenly distributed points on a sphere (Fibonacci lattice)
+        const double golden = std::numbers::pi * (3.0 - std::sqrt(5.0));
+        std::vector<Base::Vector3f> points;
+        points.reserve(count);
+        for (int i = 0; i < count; i++) {
+            double z = 1.0 - 2.0 * (i + 0.5) / count;
+            double r = std::sqrt(1.0 - z * z);
+            double phi = golden * i;
+            Base::Vector3d dir(r * std::cos(phi), r * std::sin(phi), z);
+            points.push_back(Base::convertTo<Base::Vector3f>(center + dir * radius));
+        }
+        kernel.setBasicPoints(points);
+    }
+
+    const Points::PointKernel& getKernel() const
+    {
+        return kernel;
+    }
+
+    std::vector<Base::Vector3f> getRadialNormals() const
+    {
+        std::vector<Base::Vector3f> normals;
+        for (const auto& it : kernel) {
+            Base::Vector3d dir = it - center;
+            normals.push_back(Base::convertTo<Base::Vector3f>(dir.Normalize()));
+        }
+        return normals;
+    }
+
+    static double signedVolume(const Mesh::MeshObject& mesh)
+    {
+        const MeshCore::MeshKernel& meshKernel = mesh.getKernel();
+        double volume = 0.0;
+        for (MeshCore::FacetIndex i = 0; i < meshKernel.CountFacets(); i++) {
+            MeshCore::MeshGeomFacet facet = meshKernel.GetFacet(i);
+            const Base::Vector3f& p0 = facet._aclPoints[0];
+            const Base::Vector3f& p1 = facet._aclPoints[1];
+            const Base::Vector3f& p2 = facet._aclPoints[2];
+            volume += double(p0 * (p1 % p2)) / 6.0;
+        }
+        return volume;
+    }
+
+    static void checkSphere(const Mesh::MeshObject& mesh)
+    {
+        EXPECT_GT(mesh.countFacets(), 0);
+        EXPECT_TRUE(mesh.isSolid());
+        EXPECT_FALSE(mesh.hasNonManifolds());
+        EXPECT_EQ(mesh.countNonUniformOrientedFacets(), 0);
+        EXPECT_EQ(mesh.countComponents(), 1);
+
+        // The volume is positive if the normals point outwards
+        const double volume = 4.0 / 3.0 * std::numbers::pi * std::pow(radius, 3);
+        const double area = 4.0 * std::numbers::pi * radius * radius;
+        EXPECT_NEAR(signedVolume(mesh), volume, 0.02 * volume);
+        EXPECT_NEAR(mesh.getSurface(), area, 0.02 * area);
+    }
+
+    static constexpr int count = 20000;
+    static constexpr double radius = 10.0;
+
+private:
+    Base::Vector3d center {5.0, -2.0, 1.0};
+    Points::PointKernel kernel;
+};
+
+TEST_F(SurfaceReconstructionTest, testNormalsPointOutwards)
+{
+    // Arrange
+    Reen::PointNormalEstimation estimation(getKernel());
+    estimation.setKSearch(10);
+
+    // Act
+    std::vector<Base::Vector3f> normals = estimation.perform();
+
+    // Assert
+    ASSERT_EQ(normals.size(), getKernel().size());
+    std::vector<Base::Vector3f> radial = getRadialNormals();
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_NEAR(normals[i].Length(), 1.0F, 1e-4F);
+        EXPECT_GT(normals[i] * radial[i], 0.99F) << "normal " << i << " is not radial";
+    }
+}
+
+TEST_F(SurfaceReconstructionTest, testReconstructClosedSphere)
+{
+    // Arrange
+    Mesh::MeshObject mesh;
+    Reen::SurfaceReconstruction reconstruction(getKernel(), mesh);
+
+    // Act
+    reconstruction.perform(10);
+
+    // Assert
+    checkSphere(mesh);
+}
+
+TEST_F(SurfaceReconstructionTest, testReconstructWithNormals)
+{
+    // Arrange
+    Mesh::MeshObject mesh;
+    Reen::SurfaceReconstruction reconstruction(getKernel(), mesh);
+    reconstruction.setCellSize(0.3);
+
+    // Act
+    reconstruction.perform(getRadialNormals());
+
+    // Assert
+    checkSphere(mesh);
+}
+
+TEST_F(SurfaceReconstructionTest, testNumberOfNormalsMismatch)
+{
+    Mesh::MeshObject mesh;
+    Reen::SurfaceReconstruction reconstruction(getKernel(), mesh);
+    std::vector<Base::Vector3f> normals(10, Base::Vector3f(0, 0, 1));
+    EXPECT_THROW(reconstruction.perform(normals), Base::RuntimeError);
+}
+
+TEST_F(SurfaceReconstructionTest, testCellSizeTooSmall)
+{
+    Mesh::MeshObject mesh;
+    Reen::SurfaceReconstruction reconstruction(getKernel(), mesh);
+    reconstruction.setCellSize(1e-6);
+    EXPECT_THROW(reconstruction.perform(getRadialNormals()), Base::ValueError);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
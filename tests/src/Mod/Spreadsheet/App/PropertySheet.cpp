@@ -4,6 +4,8 @@
 #include "src/App/InitApplication.h"
 
 #include <memory>
+#include <set>
+#include <vector>
 
 #include <Mod/Spreadsheet/App/Sheet.h>
 #include <Mod/Spreadsheet/App/PropertySheet.h>
@@ -86,3 +88,67 @@ TEST_F(PropertySheetTest, invalidAliases)  // NOLINT
             << "\"" << name << "\" was accepted as an alias name, and should not be";
     }
 }
+
+TEST_F(PropertySheetTest, setContentsCreatesCells)  // NOLINT
+{
+    // Arrange
+    std::vector<std::pair<App::CellAddress, std::string>> contents {
+        {App::CellAddress(0, 0), "Part"},
+        {App::CellAddress(0, 1), "Qty"},
+        {App::CellAddress(1, 0), "Bolt"},
+        {App::CellAddress(1, 1), "42"},
+    };
+
+    // Act
+    propertySheet()->setContents(contents);
+
+    // Assert
+    for (const auto& [address, content] : contents) {
+        const auto* cell = propertySheet()->getValue(address);
+        ASSERT_NE(cell, nullptr) << address.toString();
+        std::string result;
+        EXPECT_TRUE(cell->getStringContent(result));
+        EXPECT_EQ(result, content);
+    }
+    EXPECT_EQ(propertySheet()->getUsedCells().size(), contents.size());
+}
+
+TEST_F(PropertySheetTest, setContentsOverwritesExistingCells)  // NOLINT
+{
+    // Arrange
+    propertySheet()->setContent(App::CellAddress(2, 2), "old");
+
+    // Act
+    propertySheet()->setContents({{App::CellAddress(2, 2), "new"}});
+
+    // Assert
+    std::string result;
+    ASSERT_NE(propertySheet()->getValue(App::CellAddress(2, 2)), nullptr);
+    propertySheet()->getValue(App::CellAddress(2, 2))->getStringContent(result);
+    EXPECT_EQ(result, "new");
+}
+
+TEST_F(PropertySheetTest, setStyleOnSeveralCells)  // NOLINT
+{
+    // Arrange
+    std::set<std::string> bold {"bold"};
+    std::set<std::string> boldItalic {"bold", "italic"};
+    auto first = propertySheet()->createCell(App::CellAddress(0, 0));
+    auto second = propertySheet()->createCell(App::CellAddress(0, 1));
+    auto third = propertySheet()->createCell(App::CellAddress(0, 2));
+
+    // Act
+    first->setStyle(bold);
+    second->setStyle(bold);
+    third->setStyle(boldItalic);
+    second->setStyle({});
+
+    // Assert
+    std::set<std::string> style;
+    EXPECT_TRUE(first->getStyle(style));
+    EXPECT_EQ(style, bold);
+    EXPECT_FALSE(second->getStyle(style));
+    EXPECT_TRUE(style.empty());
+    EXPECT_TRUE(third->getStyle(style));
+    EXPECT_EQ(style, boldItalic);
+}
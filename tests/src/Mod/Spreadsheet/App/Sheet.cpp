@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <fstream>
+#include <sstream>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Sheet"));
+        _file.setFile(Base::FileInfo::getTempFileName() + ".csv");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+        _file.deleteFile();
+    }
+
+    App::Document* getDocument() const
+    {
+        return _doc;
+    }
+
+    Spreadsheet::Sheet* sheet() const
+    {
+        return _sheet;
+    }
+
+    const Base::FileInfo& getFile() const
+    {
+        return _file;
+    }
+
+    std::string readFile() const
+    {
+        std::ifstream str(_file.filePath(), std::ios::binary);
+        std::stringstream content;
+        content << str.rdbuf();
+        return content.str();
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+    Base::FileInfo _file;
+};
+
+TEST_F(SheetTest, setContentsWithEmptyValueClearsCell)
+{
+    // Arrange
+    sheet()->setCell("A1", "1");
+    sheet()->setCell("B1", "2");
+    getDocument()->recompute();
+    ASSERT_NE(sheet()->getPropertyByName("A1"), nullptr);
+
+    // Act
+    sheet()->cells.setContents({{App::CellAddress(0, 0), ""}, {App::CellAddress(0, 1), "3"}});
+
+    // Assert
+    // The same as Sheet::setCell() with an empty value
+    EXPECT_EQ(sheet()->getCell(App::CellAddress(0, 0)), nullptr);
+    EXPECT_EQ(sheet()->getPropertyByName("A1"), nullptr);
+    std::string content;
+    ASSERT_NE(sheet()->getCell(App::CellAddress(0, 1)), nullptr);
+    sheet()->getCell(App::CellAddress(0, 1))->getStringContent(content);
+    EXPECT_EQ(content, "3");
+}
+
+TEST_F(SheetTest, getCellValues)
+{
+    // Arrange
+    sheet()->setCell("B2", "=1+1");
+    sheet()->setCell("A1", "text");
+    sheet()->setCell("C1", "");
+    getDocument()->recompute();
+
+    // Act
+    auto values = sheet()->getCellValues();
+
+    // Assert
+    // Row-major order, empty cells are left out
+    ASSERT_EQ(values.size(), 2U);
+    EXPECT_EQ(values[0].first, App::CellAddress(0, 0));
+    EXPECT_EQ(values[0].second, sheet()->getPropertyByName("A1"));
+    EXPECT_EQ(values[1].first, App::CellAddress(1, 1));
+    EXPECT_EQ(values[1].second, sheet()->getPropertyByName("B2"));
+}
+
+TEST_F(SheetTest, exportToFile)
+{
+    // Arrange
+    sheet()->setCell("A1", "Part");
+    sheet()->setCell("B1", "Qty");
+    sheet()->setCell("A2", "Bolt");
+    sheet()->setCell("B2", "=40+2");
+    sheet()->setCell("B4", "Nut");
+    getDocument()->recompute();
+
+    // Act
+    bool written = sheet()->exportToFile(getFile().filePath(), ',');
+
+    // Assert
+    EXPECT_TRUE(written);
+    EXPECT_EQ(readFile(), "Part,Qty\nBolt,42\n\n,Nut\n");
+}
+
+TEST_F(SheetTest, exportAndImportRoundTrip)
+{
+    // Arrange
+    sheet()->setCell("A1", "a");
+    sheet()->setCell("C1", "c");
+    sheet()->setCell("B2", "b");
+    getDocument()->recompute();
+    ASSERT_TRUE(sheet()->exportToFile(getFile().filePath()));
+
+    // Act
+    sheet()->clearAll();
+    bool read = sheet()->importFromFile(getFile().filePath());
+    getDocument()->recompute();
+
+    // Assert
+    EXPECT_TRUE(read);
+    EXPECT_EQ(sheet()->getUsedCells(), (std::vector<std::string> {"A1", "C1", "B2"}));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)